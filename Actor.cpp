@@ -102,10 +102,10 @@ void GhostRacer::doSomethingSpecializedA()
 		case KEY_PRESS_SPACE:
 			if (getNumSprays() >= 1)
 			{
-				double dir = getDirection();
-				double delta_x = SPRITE_HEIGHT * cos(degreesToRad(dir)) + getX();
-				double delta_y = SPRITE_HEIGHT * sin(degreesToRad(dir)) + getY();
-				getWorld()->addActor(new Spray(getWorld(), delta_x, delta_y, dir));
+				int dir = getDirection();
+				double delta_x = SPRITE_HEIGHT * cosDegrees(dir) + getX();
+				double delta_y = SPRITE_HEIGHT * sinDegrees(dir) + getY();
+				getWorld()->addActor<Spray>(delta_x, delta_y, dir);
 				getWorld()->playSound(SOUND_PLAYER_SPRAY);
 				m_sprays--;
 			}
@@ -134,8 +134,7 @@ void GhostRacer::doSomethingSpecializedA()
 bool GhostRacer::moveRelativeToGhostRacerVerticalSpeed(double dx)
 {
 	double max_shift_per_tick = 4.0;
-	double direction = degreesToRad(getDirection());
-	double delta_x = cos(direction) * max_shift_per_tick;
+	double delta_x = cosDegrees(getDirection()) * max_shift_per_tick;
 	double cur_x = getX();
 	double cur_y = getY();
 	moveTo(cur_x + delta_x, cur_y);
@@ -147,8 +146,8 @@ bool GhostRacer::moveRelativeToGhostRacerVerticalSpeed(double dx)
 //	between[5, 20] degrees clockwise or counterclockwise of its current direction
 void GhostRacer::spin()
 {
-	int changeDir = randInt(5, 20);
-	int negOrPos = randInt(-1, 0) == -1 ? -1 : 1;
+	int changeDir = getWorld()->randInt(5, 20);
+	int negOrPos = getWorld()->randInt(-1, 0) == -1 ? -1 : 1;
 	int newDirection = getDirection() + changeDir * negOrPos;
 	if (newDirection > 120)
 		setDirection(120);
@@ -169,9 +168,9 @@ void Pedestrian::pickMovePlan()
 	// Pick new movement plan
 	const int nSpeeds = 6;
 	const int possibleXVels[nSpeeds] = { -3, -2, -1, 1, 2, 3 };
-	int randIndex = randInt(0, nSpeeds - 1);
+	int randIndex = getWorld()->randInt(0, nSpeeds - 1);
 	setXVelocity(possibleXVels[randIndex]);
-	setMovePlan(randInt(4, 32));
+	setMovePlan(getWorld()->randInt(4, 32));
 
 	if (getXVelocity() < 0)
 	{
@@ -280,10 +279,10 @@ void ZombiePedestrian::specializedAgentDamageA()
 	// then there is a 1 in 5 chance that zombie ped will add a new healing goodie at its current position
 	if (overlappingRacer == nullptr)
 	{
-		int chance = randInt(1, 5);
+		int chance = getWorld()->randInt(1, 5);
 		if (chance == 1)
 		{
-			getWorld()->addActor(new HealingGoodie(getWorld(), getX(), getY()));
+			getWorld()->addActor<HealingGoodie>(getX(), getY());
 		}
 	}
 	// Player gets 150 points
@@ -315,12 +314,12 @@ void ZombieCab::doSomethingSpecializedA()
 			if (getX() <= overlappingRacer->getX())
 			{
 				setXVelocity(-5);
-				setDirection(LEFT_DIRECTION + randInt(0, 19)); // 120 degrees plus rand [0,20)
+				setDirection(LEFT_DIRECTION + getWorld()->randInt(0, 19)); // 120 degrees plus rand [0,20)
 			}
 			else
 			{
 				setXVelocity(5);
-				setDirection(RIGHT_DIRECTION + randInt(0, 19));
+				setDirection(RIGHT_DIRECTION + getWorld()->randInt(0, 19));
 			}
 			m_hasDamagedGhostRacer = true;
 		}
@@ -364,18 +363,18 @@ void ZombieCab::doSomethingSpecializedB()
 // Zombie cab changes velocity with movement plan
 void ZombieCab::pickMovePlan()
 {
-	setMovePlan(randInt(4, 32));
-	setYVelocity(getYVelocity() + randInt(-2, 2));
+	setMovePlan(getWorld()->randInt(4, 32));
+	setYVelocity(getYVelocity() + getWorld()->randInt(-2, 2));
 }
 
 // If zombie cab is killed by holy water, then it might leave an
 // oil slick and the player gets 200 points
 void ZombieCab::specializedAgentDamageA()
 {
-	int chance = randInt(1, 5);
+	int chance = getWorld()->randInt(1, 5);
 	if (chance == 1)
 	{
-		getWorld()->addActor(new OilSlick(getWorld(), getX(), getY()));
+		getWorld()->addActor<OilSlick>(getX(), getY());
 	}
 
 	// Player gets 200 points
@@ -1,6 +1,7 @@
 #ifndef ACTOR_INCLUDED
 #define ACTOR_INCLUDED
 #include "GraphObject.h"
+#include "AngleTable.h"
 #include "StudentWorld.h"
 using namespace std;
 
@@ -14,7 +15,7 @@ class Actor : public GraphObject
 {
 public:
     Actor(StudentWorld* sw, int imageID, double x, double y, double size = 2.0, int dir = 0, int depth = 2)
-        : GraphObject(imageID, x, y, dir, size, depth), m_world(sw), m_alive(true), m_yVel(-4) {}
+        : GraphObject(sw->getGraphObjects(), imageID, x, y, dir, size, depth), m_world(sw), m_alive(true), m_yVel(-4) {}
     virtual ~Actor() {}
 
     // Action to perform for each tick.
@@ -64,25 +65,6 @@ protected:
     static const int FACING_STRAIGHT = 90;		// 90 Degrees
     static const int FACING_HORIZONTAL = 180;	// 180 Degrees
     static const int FACING_DOWN = 270;         // 270 degrees
-    const double NUM_PI = atan(1) * 4;			// pi = 3.14
-
-    // converts given degrees to radians and returns result in radians
-    double degreesToRad(double deg) { return deg * (NUM_PI / 180); }
-};
-
-
-///////////////////////////////////////////////////////////////////////////
-// Borderline Class Declaration
-///////////////////////////////////////////////////////////////////////////
-
-class BorderLine : public Actor
-{
-public:
-    BorderLine(StudentWorld* sw, double x, double y, bool isYellow)
-        : Actor(sw, isYellow ? IID_YELLOW_BORDER_LINE : IID_WHITE_BORDER_LINE, x, y) { }
-    virtual ~BorderLine() {}
-    // Borderlines do nothing other than move down vertically, which is what the Actor class
-    // do something function does, so no other functions are needed
 };
 
 
@@ -374,7 +356,7 @@ class OilSlick : public GhostRacerActivatedObject
 {
 public:
     OilSlick(StudentWorld* sw, double x, double y)
-        : GhostRacerActivatedObject(sw, IID_OIL_SLICK, x, y, randInt(2, 5)) {}
+        : GhostRacerActivatedObject(sw, IID_OIL_SLICK, x, y, sw->randInt(2, 5)) {}
     virtual ~OilSlick() {}
 
     // GhostRacer spins when it overlaps with an oil slick
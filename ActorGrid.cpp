@@ -0,0 +1,77 @@
+#include "ActorGrid.h"
+#include "Actor.h"
+#include <algorithm>
+#include <cmath>
+
+///////////////////////////////////////////////////////////////////////////
+// ActorGrid Class Implementation
+///////////////////////////////////////////////////////////////////////////
+
+// Buckets every actor by the cell its center is in (a counting sort, so each
+// cell's actors stay in increasing index order)
+void ActorGrid::build(const vector<Actor*>& actors, double racerYVel)
+{
+    m_numIndexed = actors.size();
+    m_maxRadius = 0;
+    double maxSpeed = 0;
+    m_actorCells.resize(m_numIndexed);
+    fill(m_cellStart, m_cellStart + NUM_CELLS + 1, 0);
+
+    for (int i = 0; i < m_numIndexed; i++)
+    {
+        const Actor* a = actors[i];
+        int cell = cellCoord(a->getY(), CELLS_PER_COLUMN) * CELLS_PER_ROW + cellCoord(a->getX(), CELLS_PER_ROW);
+        m_actorCells[i] = cell;
+        m_cellStart[cell + 1]++;
+        m_maxRadius = max(m_maxRadius, a->getRadius());
+        maxSpeed = max(maxSpeed, fabs(a->getXVelocity()) + fabs(a->getYVelocity() - racerYVel));
+    }
+    m_margin = maxSpeed + SPEED_CHANGE_MARGIN;
+
+    for (int c = 0; c < NUM_CELLS; c++)
+    {
+        m_cellStart[c + 1] += m_cellStart[c];
+    }
+
+    // Fill each cell from its start, using cellEnd as the running insertion point
+    int cellEnd[NUM_CELLS];
+    copy(m_cellStart, m_cellStart + NUM_CELLS, cellEnd);
+    m_cellActors.resize(m_numIndexed);
+    for (int i = 0; i < m_numIndexed; i++)
+    {
+        m_cellActors[cellEnd[m_actorCells[i]]++] = i;
+    }
+}
+
+// Replaces the contents of out with the indexes, in increasing order, of every
+// bucketed actor whose center might now be within halfWidth of x and within
+// halfHeight of y
+void ActorGrid::findNear(double x, double y, double halfWidth, double halfHeight, vector<int>& out) const
+{
+    out.clear();
+    int minCol = cellCoord(x - halfWidth - m_margin, CELLS_PER_ROW);
+    int maxCol = cellCoord(x + halfWidth + m_margin, CELLS_PER_ROW);
+    int minRow = cellCoord(y - halfHeight - m_margin, CELLS_PER_COLUMN);
+    int maxRow = cellCoord(y + halfHeight + m_margin, CELLS_PER_COLUMN);
+
+    for (int row = minRow; row <= maxRow; row++)
+    {
+        for (int col = minCol; col <= maxCol; col++)
+        {
+            int cell = row * CELLS_PER_ROW + col;
+            out.insert(out.end(), m_cellActors.begin() + m_cellStart[cell], m_cellActors.begin() + m_cellStart[cell + 1]);
+        }
+    }
+    sort(out.begin(), out.end());
+}
+
+// Returns the column (or row) of the cell containing coordinate v, clamped to the grid
+int ActorGrid::cellCoord(double v, int numCells)
+{
+    int c = static_cast<int>(floor(v / CELL_SIZE));
+    if (c < 0)
+        return 0;
+    if (c >= numCells)
+        return numCells - 1;
+    return c;
+}
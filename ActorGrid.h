@@ -0,0 +1,61 @@
+#ifndef ACTORGRID_INCLUDED
+#define ACTORGRID_INCLUDED
+
+#include "GameConstants.h"
+#include <vector>
+using namespace std;
+
+class Actor;
+
+///////////////////////////////////////////////////////////////////////////
+// ActorGrid Class Declaration
+///////////////////////////////////////////////////////////////////////////
+
+// Uniform grid over the view that buckets a world's actors by the cell their
+// center is in, so overlap queries only have to look at nearby actors.  It is
+// built at most once per tick; queries made later in the tick are widened by
+// the farthest any actor can move in one tick, which covers every actor that
+// had not yet moved when the grid was built.
+class ActorGrid
+{
+public:
+    ActorGrid() : m_numIndexed(0), m_maxRadius(0), m_margin(0) {}
+
+    // Buckets actors[0] through actors[actors.size() - 1].  racerYVel is
+    // GhostRacer's vertical speed, which every actor moves relative to.
+    void build(const vector<Actor*>& actors, double racerYVel);
+
+    // Number of actors bucketed by the last build(); actors added to the
+    // world since then are not in the grid
+    int getNumIndexed() const { return m_numIndexed; }
+
+    // Largest radius of any bucketed actor
+    double getMaxRadius() const { return m_maxRadius; }
+
+    // Replaces the contents of out with the indexes, in increasing order, of
+    // every bucketed actor whose center might now be within halfWidth of x
+    // and within halfHeight of y
+    void findNear(double x, double y, double halfWidth, double halfHeight, vector<int>& out) const;
+
+private:
+    static const int CELL_SIZE = 32;                        // Pixels per side of a cell
+    static const int CELLS_PER_ROW = VIEW_WIDTH / CELL_SIZE;
+    static const int CELLS_PER_COLUMN = VIEW_HEIGHT / CELL_SIZE;
+    static const int NUM_CELLS = CELLS_PER_ROW * CELLS_PER_COLUMN;
+
+    // How much an actor's speed can change during a tick after the grid is built
+    // (e.g., a zombie cab knocked sideways by GhostRacer, or GhostRacer speeding up)
+    static const int SPEED_CHANGE_MARGIN = 6;
+
+    int m_cellStart[NUM_CELLS + 1];     // Actors in cell c are m_cellActors[m_cellStart[c]] up to m_cellStart[c+1]
+    vector<int> m_cellActors;           // Actor indexes, grouped by cell, increasing within a cell
+    vector<int> m_actorCells;           // Cell of each bucketed actor
+    int m_numIndexed;                   // Number of actors bucketed
+    double m_maxRadius;                 // Largest radius of any bucketed actor
+    double m_margin;                    // Farthest any bucketed actor can move before the next build
+
+    // Returns the column (or row) of the cell containing coordinate v, clamped to the grid
+    static int cellCoord(double v, int numCells);
+};
+
+#endif // ACTORGRID_INCLUDED
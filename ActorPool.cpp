@@ -0,0 +1,38 @@
+#include "ActorPool.h"
+
+///////////////////////////////////////////////////////////////////////////
+// ActorPool Class Implementation
+///////////////////////////////////////////////////////////////////////////
+
+// Returns an uninitialized slot of SLOT_SIZE bytes
+void* ActorPool::allocate()
+{
+    if (m_freeList == nullptr)
+    {
+        grow();
+    }
+    Slot* slot = m_freeList;
+    m_freeList = slot->next;
+    return slot;
+}
+
+// Returns a slot obtained from allocate() to the pool
+void ActorPool::deallocate(void* p)
+{
+    Slot* slot = static_cast<Slot*>(p);
+    slot->next = m_freeList;
+    m_freeList = slot;
+}
+
+// Adds a new chunk's worth of slots to the free list
+void ActorPool::grow()
+{
+    std::unique_ptr<Slot[]> chunk(new Slot[SLOTS_PER_CHUNK]);
+    Slot* slots = chunk.get();
+    m_chunks.push_back(std::move(chunk));
+    for (int i = SLOTS_PER_CHUNK - 1; i >= 0; i--)
+    {
+        slots[i].next = m_freeList;
+        m_freeList = &slots[i];
+    }
+}
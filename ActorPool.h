@@ -0,0 +1,50 @@
+#ifndef ACTORPOOL_INCLUDED
+#define ACTORPOOL_INCLUDED
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////
+// ActorPool Class Declaration
+///////////////////////////////////////////////////////////////////////////
+
+// Fixed-size block allocator for a world's actors.  Every actor type fits in
+// one slot, so a slot freed by any actor can be reused by the next spawn of
+// any other type.  Slots are carved out of large chunks that are kept until
+// the pool itself is destroyed, so once a level has warmed up, spawning and
+// removing actors never goes to the global heap.
+class ActorPool
+{
+public:
+    static const size_t SLOT_SIZE = 160;    // Bytes per slot (largest actor must fit)
+
+    ActorPool() : m_freeList(nullptr) {}
+
+    // Returns an uninitialized slot of SLOT_SIZE bytes
+    void* allocate();
+
+    // Returns a slot obtained from allocate() to the pool
+    void deallocate(void* p);
+
+private:
+    union Slot
+    {
+        Slot* next;                                 // Next free slot, while free
+        alignas(std::max_align_t) char bytes[SLOT_SIZE];
+    };
+
+    static const int SLOTS_PER_CHUNK = 256;
+
+    std::vector<std::unique_ptr<Slot[]>> m_chunks;  // Every chunk this pool has carved slots from
+    Slot* m_freeList;                               // Singly-linked list of free slots
+
+    // Adds a new chunk's worth of slots to the free list
+    void grow();
+
+    // Prevent copying or assigning ActorPools
+    ActorPool(const ActorPool&);
+    ActorPool& operator=(const ActorPool&);
+};
+
+#endif // ACTORPOOL_INCLUDED
@@ -0,0 +1,102 @@
+#ifndef ANGLETABLE_H_
+#define ANGLETABLE_H_
+
+  // Sine and cosine of whole degrees, looked up in a table built at compile
+  // time.  Every direction in the game is a whole number of degrees, so
+  // this replaces all the runtime calls to sin() and cos().
+  //
+  // The table holds sin(0) through sin(359 degrees).  Each entry is folded
+  // into the first octant and summed from its Taylor series there, which
+  // is within 2 ulps of the true value (sin(d * M_PI / 180) from the
+  // library is often further off); the values that should be exact
+  // (0, +/-0.5, +/-1) are.
+
+const int DEGREES_PER_TURN = 360;
+
+struct AngleTableData
+{
+	double	sine[DEGREES_PER_TURN];
+};
+
+constexpr double ANGLE_TABLE_PI = 3.14159265358979323846;
+
+  // Taylor series for sin(x) and cos(x), good for |x| <= pi/4
+constexpr double taylorSin(double x)
+{
+	double term = x;
+	double sum = x;
+	for (int n = 1; n <= 12; n++)
+	{
+		term *= -x * x / ((2 * n) * (2 * n + 1));
+		sum += term;
+	}
+	return sum;
+}
+
+constexpr double taylorCos(double x)
+{
+	double term = 1;
+	double sum = 1;
+	for (int n = 1; n <= 12; n++)
+	{
+		term *= -x * x / ((2 * n - 1) * (2 * n));
+		sum += term;
+	}
+	return sum;
+}
+
+  // sin(degrees) for 0 <= degrees <= 90
+constexpr double firstQuadrantSin(int degrees)
+{
+	if (degrees == 0)
+		return 0;
+	if (degrees == 30)
+		return 0.5;
+	if (degrees == 90)
+		return 1;
+	if (degrees <= 45)
+		return taylorSin(degrees * (ANGLE_TABLE_PI / 180));
+	return taylorCos((90 - degrees) * (ANGLE_TABLE_PI / 180));
+}
+
+constexpr AngleTableData makeAngleTable()
+{
+	AngleTableData table = {};
+	for (int d = 0; d < DEGREES_PER_TURN; d++)
+	{
+		if (d <= 90)
+			table.sine[d] = firstQuadrantSin(d);
+		else if (d <= 180)
+			table.sine[d] = firstQuadrantSin(180 - d);
+		else if (d <= 270)
+			table.sine[d] = -firstQuadrantSin(d - 180);
+		else
+			table.sine[d] = -firstQuadrantSin(360 - d);
+	}
+	return table;
+}
+
+  // A function-local static, so there is one table for the whole program
+  // without needing C++17 inline variables; being constexpr, it is filled
+  // in at compile time, with no guard checked on each call
+inline const AngleTableData& angleTable()
+{
+	static constexpr AngleTableData table = makeAngleTable();
+	return table;
+}
+
+  // Any whole number of degrees, including negative ones
+inline double sinDegrees(int degrees)
+{
+	degrees %= DEGREES_PER_TURN;
+	if (degrees < 0)
+		degrees += DEGREES_PER_TURN;
+	return angleTable().sine[degrees];
+}
+
+inline double cosDegrees(int degrees)
+{
+	return sinDegrees(degrees + 90);
+}
+
+#endif // ANGLETABLE_H_
@@ -0,0 +1,121 @@
+#include "AssetBundle.h"
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstring>
+#include <algorithm>
+#include <cstdint>
+using namespace std;
+
+static const char MAGIC[4] = { 'G', 'R', 'A', 'B' };
+static const size_t ALIGNMENT = 16;
+static const int CHANNELS = 4;	// BGRA
+
+static uint64_t alignUp(uint64_t offset)
+{
+	return (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
+
+AssetBundle::AssetBundle()
+ : m_header(nullptr), m_sprites(nullptr), m_levels(nullptr)
+{
+}
+
+bool AssetBundle::write(string path, int width, int height, const vector<BundleSprite>& sprites,
+						const vector<vector<unsigned char>>& levels, uint64_t sourceStamp)
+{
+	BundleHeader header;
+	memcpy(header.magic, MAGIC, sizeof(MAGIC));
+	header.version = VERSION;
+	header.width = width;
+	header.height = height;
+	header.numSprites = static_cast<uint32_t>(sprites.size());
+	header.numLevels = static_cast<uint32_t>(levels.size());
+	header.sourceStamp = sourceStamp;
+
+	vector<BundleLevel> levelTable(levels.size());
+	uint64_t offset = sizeof(header) + sprites.size() * sizeof(BundleSprite) + levels.size() * sizeof(BundleLevel);
+	for (size_t k = 0; k < levels.size(); k++)
+	{
+		levelTable[k].width = max(width >> k, 1);
+		levelTable[k].height = max(height >> k, 1);
+		if (levels[k].size() != size_t(levelTable[k].width) * levelTable[k].height * CHANNELS)
+			return false;
+		offset = alignUp(offset);
+		levelTable[k].offset = offset;
+		offset += levels[k].size();
+	}
+
+	ofstream ofs(path, ios::binary);
+	if (!ofs)
+		return false;
+	ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	ofs.write(reinterpret_cast<const char*>(levelTable.data()), levelTable.size() * sizeof(BundleLevel));
+	ofs.write(reinterpret_cast<const char*>(sprites.data()), sprites.size() * sizeof(BundleSprite));
+	for (size_t k = 0; k < levels.size(); k++)
+	{
+		static const char padding[ALIGNMENT] = { 0 };
+		uint64_t position = static_cast<uint64_t>(ofs.tellp());
+		ofs.write(padding, levelTable[k].offset - position);
+		ofs.write(reinterpret_cast<const char*>(levels[k].data()), levels[k].size());
+	}
+	return static_cast<bool>(ofs);
+}
+
+bool AssetBundle::open(string path)
+{
+	m_header = nullptr;
+	if (!m_file.open(path))
+		return false;
+
+	const unsigned char* data = m_file.data();
+	size_t size = m_file.size();
+	if (size < sizeof(BundleHeader))
+		return false;
+	const BundleHeader* header = reinterpret_cast<const BundleHeader*>(data);
+	if (memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0  ||  header->version != VERSION  ||
+		header->width == 0  ||  header->height == 0)
+		return false;
+
+	  // Every level down to 1x1 must be there, and lie inside the file
+	uint32_t expectedLevels = 1;
+	while (expectedLevels < 32  &&  ((header->width >> expectedLevels) > 0  ||  (header->height >> expectedLevels) > 0))
+		expectedLevels++;
+	size_t tablesEnd = sizeof(BundleHeader) + header->numSprites * sizeof(BundleSprite) +
+					   header->numLevels * sizeof(BundleLevel);
+	if (header->numLevels != expectedLevels  ||  tablesEnd > size)
+		return false;
+
+	const BundleLevel* levels = reinterpret_cast<const BundleLevel*>(data + sizeof(BundleHeader));
+	for (uint32_t k = 0; k < header->numLevels; k++)
+	{
+		const BundleLevel& level = levels[k];
+		if (level.width != max(header->width >> k, 1u)  ||  level.height != max(header->height >> k, 1u)  ||
+			level.offset % ALIGNMENT != 0  ||  level.offset > size  ||
+			size - level.offset < uint64_t(level.width) * level.height * CHANNELS)
+			return false;
+	}
+
+	m_header = header;
+	m_sprites = reinterpret_cast<const BundleSprite*>(data + sizeof(BundleHeader) +
+													  header->numLevels * sizeof(BundleLevel));
+	m_levels = levels;
+	return true;
+}
+
+bool AssetBundle::hasSprite(int imageID, int frame) const
+{
+	for (int k = 0; k < getNumSprites(); k++)
+	{
+		if (m_sprites[k].imageID == imageID  &&  m_sprites[k].frame == frame)
+			return true;
+	}
+	return false;
+}
+
+const unsigned char* AssetBundle::getLevel(int level, int& width, int& height) const
+{
+	width = m_levels[level].width;
+	height = m_levels[level].height;
+	return m_file.data() + m_levels[level].offset;
+}
@@ -0,0 +1,87 @@
+#ifndef ASSETBUNDLE_H_
+#define ASSETBUNDLE_H_
+
+#include "MappedFile.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+  // Every sprite of the game, already packed into a TextureAtlas with all
+  // of its mipmap levels built, in one file that AssetPacker writes ahead
+  // of time.  The game maps the file and hands each level straight to
+  // OpenGL, instead of reading, decoding, packing, and mipmapping every TGA
+  // each time it starts.
+  //
+  // Layout (little-endian): a BundleHeader, numLevels BundleLevels,
+  // numSprites BundleSprites, then the BGRA pixels of each level, each
+  // starting on a 16-byte boundary.  Level 0 is the full atlas; each level
+  // after is half the size of the one before, down to 1x1.  The header
+  // also keeps the spriteSourceStamp of the TGA files the bundle was built
+  // from, so the game can tell when a sprite has changed since.
+
+const char* const SPRITE_BUNDLE_NAME = "sprites.bundle";
+
+struct BundleHeader
+{
+	char			magic[4];		// "GRAB"
+	std::uint32_t	version;
+	std::uint32_t	width;			// of level 0
+	std::uint32_t	height;
+	std::uint32_t	numSprites;
+	std::uint32_t	numLevels;
+	std::uint64_t	sourceStamp;	// spriteSourceStamp of the TGAs it was built from
+};
+
+struct BundleSprite
+{
+	std::int32_t	imageID;
+	std::int32_t	frame;
+	std::int32_t	cell;			// in the atlas
+};
+
+struct BundleLevel
+{
+	std::uint32_t	width;
+	std::uint32_t	height;
+	std::uint64_t	offset;			// of the pixels, from the start of the file
+};
+
+class AssetBundle
+{
+  public:
+	AssetBundle();
+
+	  // levels[0] is the atlas itself, and each level after is half the size
+	static bool write(std::string path, int width, int height, const std::vector<BundleSprite>& sprites,
+					  const std::vector<std::vector<unsigned char>>& levels, std::uint64_t sourceStamp);
+
+	  // Maps the file; returns false if it can't be mapped or isn't a
+	  // complete bundle
+	bool open(std::string path);
+
+	int getWidth() const		{ return m_header->width; }
+	int getHeight() const		{ return m_header->height; }
+	int getNumSprites() const	{ return m_header->numSprites; }
+	int getNumLevels() const	{ return m_header->numLevels; }
+	std::uint64_t getSourceStamp() const { return m_header->sourceStamp; }
+
+	const BundleSprite& getSprite(int k) const
+	{
+		return m_sprites[k];
+	}
+
+	bool hasSprite(int imageID, int frame) const;
+
+	  // Pixels of one mipmap level, straight from the mapping
+	const unsigned char* getLevel(int level, int& width, int& height) const;
+
+  private:
+	static const std::uint32_t VERSION = 2;
+
+	MappedFile			m_file;
+	const BundleHeader*	m_header;
+	const BundleSprite*	m_sprites;
+	const BundleLevel*	m_levels;
+};
+
+#endif // ASSETBUNDLE_H_
@@ -0,0 +1,59 @@
+#include "SpriteList.h"
+#include "AtlasBuilder.h"
+#include "AssetBundle.h"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+using namespace std;
+
+  // Builds the sprite bundle the game loads at startup:
+  //
+  //   AssetPacker [assetDirectory]
+  //
+  // Every sprite in SPRITE_LIST is read from its TGA file in the asset
+  // directory (Assets by default), packed into a TextureAtlas, and
+  // mipmapped down to 1x1; the result is written to sprites.bundle in the
+  // same directory.  Run it again whenever a sprite changes; if the bundle
+  // is missing, doesn't have every sprite, or was built from TGA files
+  // that have changed since, the game just loads the TGAs.
+
+static const char* const DEFAULT_ASSET_DIRECTORY = "Assets";
+
+int main(int argc, char* argv[])
+{
+	if (argc > 2)
+	{
+		cout << "usage: " << argv[0] << " [assetDirectory]" << endl;
+		return 1;
+	}
+	string path = (argc == 2 ? argv[1] : DEFAULT_ASSET_DIRECTORY);
+	if (!path.empty())
+		path += '/';
+
+	auto start = chrono::steady_clock::now();
+
+	PackedAtlas atlas;
+	string failedFile;
+	if (!buildSpriteAtlas(path, SPRITE_LIST, NUM_SPRITES, 0, atlas, failedFile))
+	{
+		cout << "Cannot load " << failedFile << endl;
+		return 1;
+	}
+
+	string bundlePath = path + SPRITE_BUNDLE_NAME;
+	if (!AssetBundle::write(bundlePath, atlas.width, atlas.height, atlas.sprites, atlas.levels, atlas.sourceStamp))
+	{
+		cout << "Cannot write " << bundlePath << endl;
+		return 1;
+	}
+
+	size_t bytes = 0;
+	for (size_t k = 0; k < atlas.levels.size(); k++)
+		bytes += atlas.levels[k].size();
+	double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	cout << "Wrote " << bundlePath << ": " << atlas.sprites.size() << " sprites in a "
+		 << atlas.width << "x" << atlas.height << " atlas, " << atlas.levels.size()
+		 << " mipmap levels, " << bytes / 1024 << " KB of pixels (" << seconds * 1000 << " ms)" << endl;
+	return 0;
+}
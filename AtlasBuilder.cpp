@@ -0,0 +1,134 @@
+#include "AtlasBuilder.h"
+#include "TextureAtlas.h"
+#include "TGAFile.h"
+#include "Profiler.h"
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <cstdint>
+#include <sys/types.h>
+#include <sys/stat.h>
+using namespace std;
+
+static const int CHANNELS = 4;	// BGRA
+
+  // One sprite's cell, at every mipmap level from CELL_SIZE down to 1x1
+struct CellLevels
+{
+	bool loaded = false;
+	vector<vector<unsigned char>> levels;
+};
+
+static CellLevels makeCellLevels(string filename)
+{
+	CellLevels result;
+	TGAImage image;
+	if (!loadTGA(filename, image))
+		return result;
+	vector<unsigned char> cell = TextureAtlas::makeCell(image.pixels.data(), image.width, image.height, image.bytesPerPixel);
+	if (cell.empty())
+		return result;
+
+	result.levels.push_back(move(cell));
+	for (int size = TextureAtlas::CELL_SIZE; size > 1; size /= 2)
+		result.levels.push_back(TextureAtlas::makeNextMipLevel(result.levels.back().data(), size, size));
+	result.loaded = true;
+	return result;
+}
+
+bool buildSpriteAtlas(string path, const SpriteInfo sprites[], int numSprites, int numThreads,
+					  PackedAtlas& atlas, string& failedFile)
+{
+	if (numThreads <= 0)
+		numThreads = max(1, static_cast<int>(thread::hardware_concurrency()));
+	numThreads = min(numThreads, max(numSprites, 1));
+	atlas.sourceStamp = spriteSourceStamp(path, sprites, numSprites);
+
+	  // Each thread takes the next sprite nobody has started on
+	vector<CellLevels> cells(numSprites);
+	atomic<int> nextSprite(0);
+	auto worker = [&]() {
+		for (int k = nextSprite++; k < numSprites; k = nextSprite++)
+		{
+			TRACE_SCOPE(sprites[k].tgaFileName);
+			cells[k] = makeCellLevels(path + sprites[k].tgaFileName);
+		}
+	};
+
+	vector<thread> threads;
+	for (int t = 1; t < numThreads; t++)
+		threads.push_back(thread(worker));
+	worker();
+	for (size_t t = 0; t < threads.size(); t++)
+		threads[t].join();
+
+	TextureAtlas layout;
+	atlas.sprites.clear();
+	for (int k = 0; k < numSprites; k++)
+	{
+		if (!cells[k].loaded)
+		{
+			failedFile = path + sprites[k].tgaFileName;
+			return false;
+		}
+		int cell = layout.addCell(cells[k].levels[0]);
+		atlas.sprites.push_back(BundleSprite{ static_cast<int>(sprites[k].imageID), static_cast<int>(sprites[k].frameNum), cell });
+	}
+
+	atlas.width = layout.getWidth();
+	atlas.height = layout.getHeight();
+	atlas.levels.clear();
+	atlas.levels.push_back(layout.takePixels());
+
+	  // While a cell is still at least a pixel across, each level of the
+	  // atlas is just the cells' own levels side by side (a 2x2 block never
+	  // straddles two cells); below that, halve the level before.
+	int width = atlas.width;
+	int height = atlas.height;
+	for (int level = 1; width > 1  ||  height > 1; level++)
+	{
+		int prevWidth = width;
+		int prevHeight = height;
+		width = max(width / 2, 1);
+		height = max(height / 2, 1);
+		if ((TextureAtlas::CELL_SIZE >> level) >= 1)
+		{
+			atlas.levels.push_back(vector<unsigned char>(size_t(width) * height * CHANNELS, 0));
+			for (int k = 0; k < numSprites; k++)
+				TextureAtlas::copyCellLevel(atlas.sprites[k].cell, level, cells[k].levels[level].data(), atlas.levels.back().data());
+		}
+		else
+			atlas.levels.push_back(TextureAtlas::makeNextMipLevel(atlas.levels.back().data(), prevWidth, prevHeight));
+	}
+	return true;
+}
+
+  // FNV-1a, a byte at a time
+static uint64_t hashBytes(uint64_t hash, const void* data, size_t size)
+{
+	const unsigned char* bytes = static_cast<const unsigned char*>(data);
+	for (size_t k = 0; k < size; k++)
+		hash = (hash ^ bytes[k]) * 1099511628211ull;
+	return hash;
+}
+
+uint64_t spriteSourceStamp(string path, const SpriteInfo sprites[], int numSprites)
+{
+	uint64_t hash = 14695981039346656037ull;
+	for (int k = 0; k < numSprites; k++)
+	{
+		string filename = path + sprites[k].tgaFileName;
+		struct stat info;
+		int64_t sizeAndTime[2] = { -1, -1 };
+		if (stat(filename.c_str(), &info) == 0)
+		{
+			sizeAndTime[0] = info.st_size;
+			sizeAndTime[1] = info.st_mtime;
+		}
+		hash = hashBytes(hash, filename.c_str(), filename.size() + 1);
+		hash = hashBytes(hash, sizeAndTime, sizeof(sizeAndTime));
+	}
+	return hash;
+}
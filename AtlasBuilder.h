@@ -0,0 +1,37 @@
+#ifndef ATLASBUILDER_H_
+#define ATLASBUILDER_H_
+
+#include "SpriteList.h"
+#include "AssetBundle.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+  // A TextureAtlas of sprites with every mipmap level built, ready to be
+  // uploaded (SpriteManager::loadAtlas) or written to a bundle
+  // (AssetBundle::write).
+
+struct PackedAtlas
+{
+	int width = 0;
+	int height = 0;
+	std::uint64_t sourceStamp = 0;	// spriteSourceStamp when the build started
+	std::vector<BundleSprite> sprites;
+	std::vector<std::vector<unsigned char>> levels;	// [0] is the atlas; each after is half the size, down to 1x1
+};
+
+  // Reads each sprite's TGA file from the directory path (which ends in
+  // '/', or is empty), and resamples and mipmaps it into its own cell, on
+  // numThreads threads (or one per hardware thread, if 0).  The cells are
+  // then put together into each level of the atlas.  Returns false, with
+  // the name of the file in failedFile, if a sprite can't be loaded.
+bool buildSpriteAtlas(std::string path, const SpriteInfo sprites[], int numSprites, int numThreads,
+					  PackedAtlas& atlas, std::string& failedFile);
+
+  // A hash of the name, size, and modification time of each sprite's TGA
+  // file (a missing file counts too).  It only takes a stat of each file,
+  // so the game can cheaply check that a bundle is no older than the
+  // sprites it was built from.
+std::uint64_t spriteSourceStamp(std::string path, const SpriteInfo sprites[], int numSprites);
+
+#endif // ATLASBUILDER_H_
@@ -0,0 +1,172 @@
+#include "AudioMixer.h"
+#include "WAVFile.h"
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+using namespace std;
+
+  // Converts a decoded sound to interleaved SAMPLE_RATE stereo, linearly
+  // interpolating between the original samples
+static vector<short> convertSound(const WAVSound& sound, int sampleRate, int channels)
+{
+	size_t inFrames = sound.samples.size() / sound.channels;
+	if (inFrames == 0)
+		return vector<short>();
+	size_t outFrames = static_cast<size_t>((double(inFrames) * sampleRate + sound.sampleRate - 1) / sound.sampleRate);
+
+	vector<short> converted(outFrames * channels);
+	double step = double(sound.sampleRate) / sampleRate;
+	for (size_t f = 0; f < outFrames; f++)
+	{
+		double position = f * step;
+		size_t from = min(static_cast<size_t>(position), inFrames - 1);
+		size_t to = min(from + 1, inFrames - 1);
+		double fraction = position - from;
+		for (int c = 0; c < channels; c++)
+		{
+			int source = min(c, sound.channels - 1);	// mono goes to both sides
+			double a = sound.samples[from * sound.channels + source];
+			double b = sound.samples[to * sound.channels + source];
+			converted[f * channels + c] = static_cast<short>(a + (b - a) * fraction);
+		}
+	}
+	return converted;
+}
+
+AudioMixer::AudioMixer()
+ : m_numClips(0), m_voicesStarted(0), m_accumulator(FRAMES_PER_BLOCK * CHANNELS),
+   m_activeVoices(0), m_droppedCommands(0), m_running(false), m_output(nullptr)
+{
+	for (int k = 0; k < MAX_VOICES; k++)
+		m_voices[k].clip = -1;
+}
+
+AudioMixer::~AudioMixer()
+{
+	stop();
+}
+
+int AudioMixer::loadClip(string filename)
+{
+	if (m_numClips == MAX_CLIPS)
+		return -1;
+	WAVSound sound;
+	if (!loadWAV(filename, sound))
+		return -1;
+
+	  // Nothing plays this clip until its number is handed out (and then
+	  // passed along through the command queue), so filling it in here
+	  // doesn't disturb the mixing thread
+	m_clips[m_numClips] = convertSound(sound, SAMPLE_RATE, CHANNELS);
+	return m_numClips++;
+}
+
+void AudioMixer::play(int clip)
+{
+	if (clip < 0  ||  clip >= MAX_CLIPS)
+		return;
+	if (!m_commands.push(Command{ PLAY, clip }))
+		m_droppedCommands++;
+}
+
+void AudioMixer::stopAll()
+{
+	if (!m_commands.push(Command{ STOP_ALL, -1 }))
+		m_droppedCommands++;
+}
+
+bool AudioMixer::start(AudioOutput* output)
+{
+	if (m_running  ||  output == nullptr  ||  !output->open(SAMPLE_RATE, CHANNELS))
+		return false;
+	m_output = output;
+	m_running = true;
+	m_thread = thread(&AudioMixer::run, this);
+	return true;
+}
+
+void AudioMixer::stop()
+{
+	if (!m_running)
+		return;
+	m_running = false;
+	m_thread.join();
+	m_output->close();
+	m_output = nullptr;
+}
+
+void AudioMixer::run()
+{
+	vector<short> block(FRAMES_PER_BLOCK * CHANNELS);
+	while (m_running)
+	{
+		mix(block.data(), FRAMES_PER_BLOCK);
+		m_output->write(block.data(), FRAMES_PER_BLOCK);
+	}
+}
+
+void AudioMixer::startVoice(int clip)
+{
+	  // Take a free voice, or else the oldest
+	Voice* voice = &m_voices[0];
+	for (int k = 0; k < MAX_VOICES; k++)
+	{
+		if (m_voices[k].clip < 0)
+		{
+			voice = &m_voices[k];
+			break;
+		}
+		if (m_voices[k].started < voice->started)
+			voice = &m_voices[k];
+	}
+	voice->clip = clip;
+	voice->frame = 0;
+	voice->started = m_voicesStarted++;
+}
+
+void AudioMixer::mix(short* out, int frames)
+{
+	Command command;
+	while (m_commands.pop(command))
+	{
+		if (command.type == PLAY)
+		{
+			if (!m_clips[command.clip].empty())
+				startVoice(command.clip);
+		}
+		else
+		{
+			for (int k = 0; k < MAX_VOICES; k++)
+				m_voices[k].clip = -1;
+		}
+	}
+
+	size_t samples = size_t(frames) * CHANNELS;
+	if (m_accumulator.size() < samples)
+		m_accumulator.resize(samples);
+	fill(m_accumulator.begin(), m_accumulator.begin() + samples, 0);
+
+	int active = 0;
+	for (int k = 0; k < MAX_VOICES; k++)
+	{
+		Voice& voice = m_voices[k];
+		if (voice.clip < 0)
+			continue;
+		const vector<short>& clip = m_clips[voice.clip];
+		size_t first = voice.frame * CHANNELS;
+		size_t count = min(samples, clip.size() - first);
+		for (size_t s = 0; s < count; s++)
+			m_accumulator[s] += clip[first + s];
+		voice.frame += count / CHANNELS;
+		if (voice.frame * CHANNELS >= clip.size())
+			voice.clip = -1;	// finished
+		else
+			active++;
+	}
+	m_activeVoices.store(active, memory_order_relaxed);
+
+	for (size_t s = 0; s < samples; s++)
+		out[s] = static_cast<short>(min(max(m_accumulator[s], -32768), 32767));
+}
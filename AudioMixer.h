@@ -0,0 +1,100 @@
+#ifndef AUDIOMIXER_H_
+#define AUDIOMIXER_H_
+
+#include "AudioOutput.h"
+#include "RingQueue.h"
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+
+  // Plays sound clips, any number at once, by mixing them ourselves and
+  // sending the result to an AudioOutput.  Every clip is decoded and
+  // converted to SAMPLE_RATE stereo once, when it is loaded, so playing one
+  // just starts a voice reading through samples already in memory.
+  //
+  // play() and stopAll() only push a command onto a lock-free queue, so any
+  // thread (e.g., the simulation thread) can call them without waiting.
+  // The mixing thread started by start() takes the commands at the start
+  // of each block it mixes, so a sound starts within a block or so.
+
+class AudioMixer
+{
+  public:
+	static const int SAMPLE_RATE = 44100;
+	static const int CHANNELS = 2;
+	static const int FRAMES_PER_BLOCK = 512;	// about 12 ms
+	static const int MAX_VOICES = 16;			// sounds playing at once
+	static const int MAX_CLIPS = 64;
+
+	AudioMixer();
+	~AudioMixer();
+
+	  // Loads a WAV file and returns the clip number to play() it by, or -1
+	  // if it can't be loaded.  Call from one thread at a time.
+	int loadClip(std::string filename);
+
+	  // If every voice is busy, the one that has been playing longest is
+	  // cut off for this one
+	void play(int clip);
+	void stopAll();
+
+	  // Mixes block after block to output on a thread of its own, until
+	  // stop().  Returns false if output can't be opened.
+	bool start(AudioOutput* output);
+	void stop();
+
+	  // Mixes the next frames frames into out (frames * CHANNELS samples).
+	  // This is what the mixing thread calls; without start(), call it
+	  // directly to render the sound offline.
+	void mix(short* out, int frames);
+
+	int activeVoices() const
+	{
+		return m_activeVoices.load(std::memory_order_relaxed);
+	}
+
+	  // Commands dropped because the queue was full
+	long droppedCommands() const
+	{
+		return m_droppedCommands.load(std::memory_order_relaxed);
+	}
+
+  private:
+	enum CommandType { PLAY, STOP_ALL };
+
+	struct Command
+	{
+		CommandType	type;
+		int			clip;
+	};
+
+	struct Voice
+	{
+		int				clip;		// -1 if free
+		std::size_t		frame;		// next one to mix
+		unsigned long	started;	// order voices were started in
+	};
+
+	std::vector<short>			m_clips[MAX_CLIPS];		// interleaved stereo
+	int							m_numClips;
+	Voice						m_voices[MAX_VOICES];	// only touched by mix()
+	unsigned long				m_voicesStarted;
+	std::vector<int>			m_accumulator;
+	RingQueue<Command, 256>		m_commands;
+	std::atomic<int>			m_activeVoices;
+	std::atomic<long>			m_droppedCommands;
+
+	std::thread					m_thread;
+	std::atomic<bool>			m_running;
+	AudioOutput*				m_output;
+
+	void startVoice(int clip);
+	void run();
+
+	  // Prevent copying or assigning AudioMixers
+	AudioMixer(const AudioMixer&);
+	AudioMixer& operator=(const AudioMixer&);
+};
+
+#endif // AUDIOMIXER_H_
@@ -0,0 +1,304 @@
+#include "AudioOutput.h"
+#include <string>
+#include <fstream>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+using namespace std;
+
+  // Sleep until the frames just written would have finished playing.  If
+  // we've fallen well behind (e.g., the process was stopped in a
+  // debugger), start the clock over rather than rush to catch up.
+static void waitForPlayback(chrono::steady_clock::time_point& due, int frames, int sampleRate)
+{
+	auto now = chrono::steady_clock::now();
+	if (due < now - chrono::milliseconds(100))
+		due = now;
+	due += chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(double(frames) / sampleRate));
+	this_thread::sleep_until(due);
+}
+
+WAVFileOutput::WAVFileOutput(string path, bool realTime)
+ : m_path(path), m_realTime(realTime), m_sampleRate(0), m_channels(0), m_framesWritten(0)
+{
+}
+
+WAVFileOutput::~WAVFileOutput()
+{
+	close();
+}
+
+bool WAVFileOutput::open(int sampleRate, int channels)
+{
+	m_file.open(m_path, ios::out|ios::binary|ios::trunc);
+	if (!m_file)
+		return false;
+	m_sampleRate = sampleRate;
+	m_channels = channels;
+	m_framesWritten = 0;
+	m_due = chrono::steady_clock::now();
+	writeHeader();	// rewritten with the real sizes by close()
+	return static_cast<bool>(m_file);
+}
+
+void WAVFileOutput::write(const short* samples, int frames)
+{
+	  // WAV samples are little-endian, as are the machines we run on
+	m_file.write(reinterpret_cast<const char*>(samples), streamsize(frames) * m_channels * sizeof(short));
+	m_framesWritten += frames;
+	if (m_realTime)
+		waitForPlayback(m_due, frames, m_sampleRate);
+}
+
+void WAVFileOutput::close()
+{
+	if (!m_file.is_open())
+		return;
+	m_file.seekp(0);
+	writeHeader();
+	m_file.close();
+}
+
+void WAVFileOutput::writeHeader()
+{
+	uint32_t dataSize = static_cast<uint32_t>(m_framesWritten * m_channels * sizeof(short));
+	unsigned char header[44];
+	auto put = [&](int offset, uint32_t value, int bytes) {
+		for (int k = 0; k < bytes; k++, value /= 256)
+			header[offset + k] = static_cast<unsigned char>(value % 256);
+	};
+	memcpy(header, "RIFF", 4);
+	put(4, 36 + dataSize, 4);
+	memcpy(header + 8, "WAVEfmt ", 8);
+	put(16, 16, 4);									// size of the fmt chunk
+	put(20, 1, 2);									// PCM
+	put(22, m_channels, 2);
+	put(24, m_sampleRate, 4);
+	put(28, m_sampleRate * m_channels * sizeof(short), 4);	// bytes per second
+	put(32, m_channels * sizeof(short), 2);			// bytes per frame
+	put(34, 16, 2);									// bits per sample
+	memcpy(header + 36, "data", 4);
+	put(40, dataSize, 4);
+	m_file.write(reinterpret_cast<const char*>(header), sizeof(header));
+}
+
+#if defined(_WIN32)
+
+#define NOMINMAX
+#include <windows.h>
+#include <mmsystem.h>
+#pragma comment(lib, "winmm.lib")
+
+  // Plays through waveOut, keeping NUM_BUFFERS blocks queued.  Writing
+  // waits (on an event the driver signals) until the oldest is done.
+class WinMMOutput : public AudioOutput
+{
+  public:
+	WinMMOutput()
+	 : m_device(nullptr), m_event(nullptr), m_channels(0), m_next(0)
+	{
+	}
+
+	virtual ~WinMMOutput()
+	{
+		close();
+	}
+
+	virtual bool open(int sampleRate, int channels)
+	{
+		WAVEFORMATEX format = {};
+		format.wFormatTag = WAVE_FORMAT_PCM;
+		format.nChannels = static_cast<WORD>(channels);
+		format.nSamplesPerSec = sampleRate;
+		format.wBitsPerSample = 16;
+		format.nBlockAlign = static_cast<WORD>(channels * sizeof(short));
+		format.nAvgBytesPerSec = sampleRate * format.nBlockAlign;
+
+		m_event = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+		if (m_event == nullptr)
+			return false;
+		if (waveOutOpen(&m_device, WAVE_MAPPER, &format, reinterpret_cast<DWORD_PTR>(m_event), 0, CALLBACK_EVENT) != MMSYSERR_NOERROR)
+		{
+			m_device = nullptr;
+			close();
+			return false;
+		}
+		m_channels = channels;
+		for (int k = 0; k < NUM_BUFFERS; k++)
+		{
+			m_headers[k] = WAVEHDR();
+			m_buffers[k].resize(MAX_FRAMES_PER_WRITE * channels);
+		}
+		return true;
+	}
+
+	virtual void write(const short* samples, int frames)
+	{
+		WAVEHDR& header = m_headers[m_next];
+		while ((header.dwFlags & WHDR_PREPARED)  &&  !(header.dwFlags & WHDR_DONE))
+			WaitForSingleObject(m_event, INFINITE);
+		if (header.dwFlags & WHDR_PREPARED)
+			waveOutUnprepareHeader(m_device, &header, sizeof(header));
+
+		frames = min(frames, int(MAX_FRAMES_PER_WRITE));
+		memcpy(m_buffers[m_next].data(), samples, frames * m_channels * sizeof(short));
+		header = WAVEHDR();
+		header.lpData = reinterpret_cast<LPSTR>(m_buffers[m_next].data());
+		header.dwBufferLength = static_cast<DWORD>(frames * m_channels * sizeof(short));
+		waveOutPrepareHeader(m_device, &header, sizeof(header));
+		waveOutWrite(m_device, &header, sizeof(header));
+		m_next = (m_next + 1) % NUM_BUFFERS;
+	}
+
+	virtual void close()
+	{
+		if (m_device != nullptr)
+		{
+			waveOutReset(m_device);
+			for (int k = 0; k < NUM_BUFFERS; k++)
+			{
+				if (m_headers[k].dwFlags & WHDR_PREPARED)
+					waveOutUnprepareHeader(m_device, &m_headers[k], sizeof(m_headers[k]));
+			}
+			waveOutClose(m_device);
+			m_device = nullptr;
+		}
+		if (m_event != nullptr)
+			CloseHandle(m_event);
+		m_event = nullptr;
+	}
+
+  private:
+	static const int NUM_BUFFERS = 3;
+
+	HWAVEOUT		m_device;
+	HANDLE			m_event;
+	int				m_channels;
+	int				m_next;
+	WAVEHDR			m_headers[NUM_BUFFERS];
+	vector<short>	m_buffers[NUM_BUFFERS];
+};
+
+AudioOutput* createDeviceOutput()
+{
+	return new WinMMOutput;
+}
+
+#elif defined(__APPLE__)
+
+#include <AudioToolbox/AudioToolbox.h>
+#include <mutex>
+#include <condition_variable>
+
+  // Plays through an AudioQueue (link with -framework AudioToolbox),
+  // keeping NUM_BUFFERS blocks queued.  The queue hands each buffer back
+  // on its own thread once it has played; writing waits for one.
+class AudioQueueOutput : public AudioOutput
+{
+  public:
+	AudioQueueOutput()
+	 : m_queue(nullptr), m_channels(0), m_started(false)
+	{
+	}
+
+	virtual ~AudioQueueOutput()
+	{
+		close();
+	}
+
+	virtual bool open(int sampleRate, int channels)
+	{
+		AudioStreamBasicDescription format = {};
+		format.mSampleRate = sampleRate;
+		format.mFormatID = kAudioFormatLinearPCM;
+		format.mFormatFlags = kLinearPCMFormatFlagIsSignedInteger | kLinearPCMFormatFlagIsPacked;
+		format.mFramesPerPacket = 1;
+		format.mChannelsPerFrame = channels;
+		format.mBitsPerChannel = 16;
+		format.mBytesPerFrame = format.mBytesPerPacket = channels * sizeof(short);
+
+		if (AudioQueueNewOutput(&format, bufferPlayed, this, nullptr, nullptr, 0, &m_queue) != noErr)
+		{
+			m_queue = nullptr;
+			return false;
+		}
+		m_channels = channels;
+		for (int k = 0; k < NUM_BUFFERS; k++)
+		{
+			AudioQueueBufferRef buffer;
+			if (AudioQueueAllocateBuffer(m_queue, MAX_FRAMES_PER_WRITE * channels * sizeof(short), &buffer) != noErr)
+			{
+				close();
+				return false;
+			}
+			m_free.push_back(buffer);
+		}
+		return true;
+	}
+
+	virtual void write(const short* samples, int frames)
+	{
+		AudioQueueBufferRef buffer;
+		{
+			unique_lock<mutex> lock(m_mutex);
+			m_bufferFreed.wait(lock, [this]{ return !m_free.empty(); });
+			buffer = m_free.back();
+			m_free.pop_back();
+		}
+		frames = min(frames, int(MAX_FRAMES_PER_WRITE));
+		memcpy(buffer->mAudioData, samples, frames * m_channels * sizeof(short));
+		buffer->mAudioDataByteSize = static_cast<UInt32>(frames * m_channels * sizeof(short));
+		AudioQueueEnqueueBuffer(m_queue, buffer, 0, nullptr);
+		if (!m_started)
+			m_started = (AudioQueueStart(m_queue, nullptr) == noErr);
+	}
+
+	virtual void close()
+	{
+		if (m_queue != nullptr)
+		{
+			AudioQueueStop(m_queue, true);
+			AudioQueueDispose(m_queue, true);	// frees the buffers too
+		}
+		m_queue = nullptr;
+		m_free.clear();
+		m_started = false;
+	}
+
+  private:
+	static const int NUM_BUFFERS = 3;
+
+	AudioQueueRef				m_queue;
+	int							m_channels;
+	bool						m_started;
+	mutex						m_mutex;
+	condition_variable			m_bufferFreed;
+	vector<AudioQueueBufferRef>	m_free;
+
+	static void bufferPlayed(void* userData, AudioQueueRef, AudioQueueBufferRef buffer)
+	{
+		AudioQueueOutput* self = static_cast<AudioQueueOutput*>(userData);
+		{
+			lock_guard<mutex> lock(self->m_mutex);
+			self->m_free.push_back(buffer);
+		}
+		self->m_bufferFreed.notify_one();
+	}
+};
+
+AudioOutput* createDeviceOutput()
+{
+	return new AudioQueueOutput;
+}
+
+#else
+
+AudioOutput* createDeviceOutput()
+{
+	return nullptr;
+}
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef AUDIOOUTPUT_H_
+#define AUDIOOUTPUT_H_
+
+#include <string>
+#include <fstream>
+#include <chrono>
+
+  // Where an AudioMixer sends what it mixes: signed 16 bit samples,
+  // interleaved if there is more than one channel.  write() returns once
+  // there is room for the next block, so a thread that does nothing but
+  // mix and write is held to real time by the output.
+
+class AudioOutput
+{
+  public:
+	static const int MAX_FRAMES_PER_WRITE = 4096;
+
+	virtual ~AudioOutput() {}
+
+	  // Returns false if the output can't play this format
+	virtual bool open(int sampleRate, int channels) = 0;
+	virtual void write(const short* samples, int frames) = 0;
+	virtual void close() = 0;
+};
+
+  // The platform's sound device (winmm on Windows, an AudioQueue on macOS),
+  // or nullptr if this platform has none we can use
+AudioOutput* createDeviceOutput();
+
+  // Saves the samples to a WAV file.  In real time, it takes as long to
+  // write as to play, as if it were a device; otherwise it writes as fast
+  // as it is given samples, for rendering offline.
+class WAVFileOutput : public AudioOutput
+{
+  public:
+	WAVFileOutput(std::string path, bool realTime);
+	virtual ~WAVFileOutput();
+
+	virtual bool open(int sampleRate, int channels);
+	virtual void write(const short* samples, int frames);
+	virtual void close();
+
+  private:
+	std::string		m_path;
+	bool			m_realTime;
+	std::ofstream	m_file;
+	int				m_sampleRate;
+	int				m_channels;
+	long			m_framesWritten;
+	std::chrono::steady_clock::time_point m_due;
+
+	void writeHeader();
+};
+
+#endif // AUDIOOUTPUT_H_
@@ -0,0 +1,175 @@
+#include "HeadlessController.h"
+#include "StudentWorld.h"
+#include "Actor.h"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+using namespace std;
+
+  // Times GameWorld::runTick(), just as the game runs it, under fixed
+  // scenarios:
+  //
+  //   GhostRacerBench [--ticks N] [--seed N]
+  //
+  // "level 1" and "level 10" play the real game at that level's spawn
+  // rates.  The "N actors" scenarios top m_actors up to N synthetic actors
+  // before every tick, so the update pass always sees that many, and have
+  // GhostRacer fire holy water every tick so sprays are in the mix.
+  // Resetting the world after the racer dies, refilling actors and sprays
+  // and healing the racer are not timed.  Every scenario starts from the
+  // same seed, so two builds run exactly the same workload.
+  //
+  // The time spent in each phase of move() (updating actors, sweeping out
+  // the dead, and spawning new ones) is reported too, as the world times
+  // it with StudentWorld::timePhases().
+
+using Clock = chrono::steady_clock;
+
+static const long DEFAULT_SEED = 1;
+
+struct Scenario
+{
+	const char*	name;
+	int			level;
+	int			syntheticActors;	// 0 means: just play the level
+};
+
+
+  // Add actors that keep the racer alive long enough to be useful: no
+  // human pedestrians (instant death) and no souls (they end the level).
+static void addSyntheticActor(StudentWorld& world)
+{
+	double x = world.randInt(0, VIEW_WIDTH);
+	double y = world.randInt(VIEW_HEIGHT / 3, VIEW_HEIGHT);
+	switch (world.randInt(0, 4))
+	{
+		case 0:	world.addActor<ZombiePedestrian>(x, y);		break;
+		case 1:	world.addActor<ZombieCab>(x, y);			break;
+		case 2:	world.addActor<OilSlick>(x, y);				break;
+		case 3:	world.addActor<HolyWaterGoodie>(x, y);		break;
+		default: world.addActor<HealingGoodie>(x, y);		break;
+	}
+}
+
+static void resetWorld(StudentWorld& world)
+{
+	world.cleanUp();
+	world.init();
+}
+
+static void runScenario(const Scenario& s, long ticks, long seed)
+{
+	HeadlessController controller;
+	StudentWorld world("");
+	world.setController(&controller);
+	world.setSeed(seed);
+	StudentWorld::PhaseTimes phases;
+	world.timePhases(&phases);
+	for (int k = 1; k < s.level; k++)
+		world.advanceToNextLevel();
+	world.init();
+
+	vector<long long> tickNs;
+	tickNs.reserve(ticks);
+	long long actorTicks = 0;
+	long resets = 0;
+
+	for (long t = 0; t < ticks; t++)
+	{
+		if (s.syntheticActors > 0)
+		{
+			while (world.getNumActors() < s.syntheticActors)
+				addSyntheticActor(world);
+			world.getRacer()->setHealth(100);
+			if (world.getRacer()->getNumSprays() == 0)
+				world.getRacer()->increaseSprays(10);
+			controller.pressKey(KEY_PRESS_SPACE);
+		}
+		actorTicks += world.getNumActors();
+
+		Clock::time_point start = Clock::now();
+		int status = world.runTick();
+		tickNs.push_back(chrono::duration_cast<chrono::nanoseconds>(Clock::now() - start).count());
+
+		if (status != GWSTATUS_CONTINUE_GAME)
+		{
+			resets++;
+			resetWorld(world);
+		}
+	}
+
+	long long sum = 0;
+	for (long long ns : tickNs)
+		sum += ns;
+	sort(tickNs.begin(), tickNs.end());
+	double perTick = double(sum) / ticks;
+	double avgActors = double(actorTicks) / ticks;
+
+	cout << left << setw(14) << s.name << right << fixed << setprecision(0)
+		 << setw(8) << ticks
+		 << setw(10) << avgActors
+		 << setw(12) << perTick
+		 << setw(11) << tickNs[ticks / 2]
+		 << setw(11) << tickNs[ticks * 99 / 100]
+		 << setw(10) << setprecision(1) << (avgActors > 0 ? perTick / avgActors : 0) << setprecision(0)
+		 << setw(8) << resets
+		 << setw(10) << double(phases.update) / ticks
+		 << setw(10) << double(phases.sweep) / ticks
+		 << setw(10) << double(phases.spawn) / ticks << endl;
+}
+
+int main(int argc, char* argv[])
+{
+	long ticksOverride = 0;
+	long seed = DEFAULT_SEED;
+	for (int k = 1; k < argc; k++)
+	{
+		char* end = nullptr;
+		long* value = nullptr;
+		if (strcmp(argv[k], "--ticks") == 0  &&  k+1 < argc)
+			value = &ticksOverride;
+		else if (strcmp(argv[k], "--seed") == 0  &&  k+1 < argc)
+			value = &seed;
+		if (value != nullptr)
+			*value = strtol(argv[++k], &end, 10);
+		if (end == nullptr  ||  *end != '\0'  ||  *value <= 0)
+		{
+			cout << "usage: " << argv[0] << " [--ticks N] [--seed N]" << endl;
+			return 1;
+		}
+	}
+
+	const Scenario scenarios[] = {
+		{ "level 1",		 1,		0 },
+		{ "level 10",		10,		0 },
+		{ "100 actors",		 1,	  100 },
+		{ "1000 actors",	 1,	 1000 },
+		{ "10000 actors",	 1,	10000 },
+	};
+
+	cout << left << setw(14) << "scenario" << right
+		 << setw(8) << "ticks"
+		 << setw(10) << "actors"
+		 << setw(12) << "ns/tick"
+		 << setw(11) << "p50"
+		 << setw(11) << "p99"
+		 << setw(10) << "ns/actor"
+		 << setw(8) << "resets"
+		 << setw(10) << "update"
+		 << setw(10) << "sweep"
+		 << setw(10) << "spawn" << endl;
+
+	for (const Scenario& s : scenarios)
+	{
+		  // Keep the bigger worlds from taking forever by default
+		long ticks = ticksOverride;
+		if (ticks == 0)
+			ticks = (s.syntheticActors == 0 ? 20000 : max(200L, 2000000L / s.syntheticActors));
+		runScenario(s, ticks, seed);
+	}
+}
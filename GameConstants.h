@@ -1,9 +1,6 @@
 #ifndef GAMECONSTANTS_H_
 #define GAMECONSTANTS_H_
 
-#include <random>
-#include <utility>
-
 // image IDs for the game objects
 
 const int IID_GHOST_RACER = 0;
@@ -35,6 +32,8 @@ const int SOUND_GOT_SOUL = 11;
 const int SOUND_ZOMBIE_ATTACK = 12;
 const int SOUND_NONE = -1;
 
+const int NUM_SOUND_IDS = 13;	// sound IDs run from 0 to NUM_SOUND_IDS-1
+
 // keys the user can hit
 
 const int KEY_PRESS_LEFT   = 1000;
@@ -74,17 +73,4 @@ const int GWSTATUS_LEVEL_ERROR    = 4;
 
 const int NUM_TEST_PARAMS = 1;
 
-// Return a uniformly distributed random int from min to max, inclusive
-
-inline
-int randInt(int min, int max)
-{
-    if (max < min)
-        std::swap(max, min);
-    static std::random_device rd;
-    static std::default_random_engine generator(rd());
-    std::uniform_int_distribution<> distro(min, max);
-    return distro(generator);
-}
-
 #endif // GAMECONSTANTS_H_
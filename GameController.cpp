@@ -5,11 +5,20 @@
 #include "GraphObject.h"
 #include "SoundFX.h"
 #include "SpriteManager.h"
+#include "SpriteList.h"
+#include "SoundList.h"
+#include "AssetBundle.h"
+#include "AtlasBuilder.h"
 #include <string>
 #include <map>
 #include <utility>
 #include <cstdlib>
 #include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <chrono>
+#include <thread>
+#include <mutex>
 using namespace std;
 
 /*
@@ -48,74 +57,77 @@ static const double FONT_SCALEDOWN = 760.0;
 static const double SCORE_Y = 3.8;
 static const double SCORE_Z = -10;
 
-static const int MS_PER_FRAME = 5;
-
-int GameController::m_ms_per_tick = kDefaultMsPerTick;
-
-struct SpriteInfo
-{
-	unsigned int imageID;
-	unsigned int frameNum;
-	std::string	 tgaFileName;
-};
+  // Unless setTickRate() or setFrameRate() says otherwise (ticks used to
+  // be run from the frame timer, one every third frame)
+static const int DEFAULT_MS_PER_FRAME = 5;
+static const int DEFAULT_MS_PER_TICK = 3 * DEFAULT_MS_PER_FRAME;
 
 static void convertToGlutCoords(double x, double y, double& gx, double& gy, double& gz);
 static void drawPrompt(string mainMessage, string secondMessage);
-static void drawScoreAndLives(string);
+static void outputStrokeCentered(double y, double z, const char* str);
+static void drawScoreAndLives(GLuint statTextList);
 
 enum GameController::GameControllerState : int {
-    welcome, contgame, finishedlevel, init, cleanup, makemove, animate, gameover, prompt, quit, not_applicable
+    welcome, contgame, finishedlevel, init, cleanup, makemove, gameover, prompt, quit, not_applicable
+};
+
+#ifdef GR_PROFILE
+  // In the order of GameControllerState, for the trace
+static const char* const STATE_NAMES[] = {
+	"welcome", "contgame", "finishedlevel", "init", "cleanup", "makemove", "gameover", "prompt", "quit", "not_applicable"
 };
+#endif
 
 void GameController::initDrawersAndSounds()
 {
-	SpriteInfo drawers[] = {
-		{ IID_GHOST_RACER	 , 0, "redcar.tga" },
-		{ IID_WHITE_BORDER_LINE	 , 0, "white-lane.tga" },
-		{ IID_YELLOW_BORDER_LINE , 0, "yellow-lane.tga" },
-		{ IID_OIL_SLICK	, 0, "oil.tga" },
-		{ IID_HUMAN_PED	, 0, "dude_1.tga" },
-		{ IID_HUMAN_PED	, 1, "dude_2.tga" },
-		{ IID_HUMAN_PED	, 2, "dude_3.tga" },
-		{ IID_ZOMBIE_PED	, 0, "zombie_1.tga" },
-		{ IID_ZOMBIE_PED	, 1, "zombie_2.tga" },
-		{ IID_ZOMBIE_PED	, 2, "zombie_3.tga" },
-		{ IID_ZOMBIE_CAB		   , 0, "yellow.tga" },
-		{ IID_HOLY_WATER_PROJECTILE	   , 0, "water1.tga" },
-		{ IID_HOLY_WATER_PROJECTILE	   , 1, "water2.tga" },
-		{ IID_HOLY_WATER_PROJECTILE	   , 2, "water3.tga" },
-		{ IID_HEAL_GOODIE  , 0, "health.tga"},
-		{ IID_HOLY_WATER_GOODIE  , 0, "holy_water.tga"},
-		{ IID_SOUL_GOODIE  , 0, "soul.tga"},
-	};
-
-	SoundMapType::value_type sounds[] = {
-		make_pair(SOUND_PED_HURT			, "hurt.wav"),
-		make_pair(SOUND_VEHICLE_HURT        ,"hurt.wav"),
-		make_pair(SOUND_VEHICLE_CRASH        ,"crash.wav"),
-		make_pair(SOUND_PLAYER_DIE             , "die.wav"),
-		make_pair(SOUND_OIL_SLICK             , "skid.wav"),
-		make_pair(SOUND_FINISHED_LEVEL		   , "finished.wav"),
-		make_pair(SOUND_PLAYER_SPRAY		   , "squirt.wav"),
-		make_pair(SOUND_VEHICLE_DIE			   , "zombiedie.wav"),
-		make_pair(SOUND_PED_DIE					, "zombiedie.wav"),
-		make_pair(SOUND_THEME					, "theme.wav"),
-		make_pair(SOUND_GOT_GOODIE		    , "goodie.wav"),
-		make_pair(SOUND_GOT_SOUL		    , "bell.wav"),
-		make_pair(SOUND_ZOMBIE_ATTACK		, "attack.wav")
-	};
-
-	for (int k = 0; k < sizeof(drawers)/sizeof(drawers[0]); k++)
+	string path = m_gw->assetPath();
+	if (!path.empty())
+		path += '/';
+
+	TRACE_SCOPE("load assets");
+	auto start = chrono::steady_clock::now();
+
+	  // Use the prebuilt bundle if there is one with every sprite in it,
+	  // built from the TGAs as they are now; otherwise decode, pack, and
+	  // mipmap the TGAs on worker threads, and just upload the result here
+	AssetBundle bundle;
+	bool useBundle = bundle.open(path + SPRITE_BUNDLE_NAME)  &&  bundle.getWidth() == TextureAtlas::ATLAS_WIDTH;
+	for (int k = 0; useBundle  &&  k < NUM_SPRITES; k++)
+		useBundle = bundle.hasSprite(SPRITE_LIST[k].imageID, SPRITE_LIST[k].frameNum);
+	if (useBundle  &&  bundle.getSourceStamp() != spriteSourceStamp(path, SPRITE_LIST, NUM_SPRITES))
+	{
+		cout << SPRITE_BUNDLE_NAME << " is older than the sprites; run AssetPacker again" << endl;
+		useBundle = false;
+	}
+
+	if (useBundle)
+		m_spriteManager.loadBundle(bundle);
+	else
 	{
-		string path = m_gw->assetPath();
-		if (!path.empty())
-			path += '/';
-		const SpriteInfo& d = drawers[k];
-		if (!m_spriteManager.loadSprite(path + d.tgaFileName, d.imageID, d.frameNum))
+		PackedAtlas atlas;
+		string failedFile;
+		if (!buildSpriteAtlas(path, SPRITE_LIST, NUM_SPRITES, 0, atlas, failedFile))
+		{
+			cout << "Cannot load " << failedFile << endl;
 			exit(0);
+		}
+		m_spriteManager.loadAtlas(atlas);
+	}
+
+	auto stop = chrono::steady_clock::now();
+	TRACE_SPAN(useBundle ? "load sprite bundle" : "build sprite atlas", "game", start, stop);
+	double ms = chrono::duration<double, milli>(stop - start).count();
+	cout << "Loaded " << NUM_SPRITES << " sprites from " << (useBundle ? SPRITE_BUNDLE_NAME : "TGA files")
+		 << " in " << ms << " ms" << endl;
+
+	  // Decode every sound now, so playing one later is just a queued command
+	for (int k = 0; k < NUM_SOUND_IDS; k++)
+		m_soundClips[k] = -1;
+	for (int k = 0; k < NUM_SOUNDS; k++)
+	{
+		TRACE_SCOPE(SOUND_LIST[k].wavFileName);
+		m_soundClips[SOUND_LIST[k].soundID] = SoundFX().loadClip(path + SOUND_LIST[k].wavFileName);
 	}
-	for (int k = 0; k < sizeof(sounds)/sizeof(sounds[0]); k++)
-		m_soundMap[sounds[k].first] = sounds[k].second;
 }
 
 static void doSomethingCallback()
@@ -138,21 +150,67 @@ static void specialKeyboardEventCallback(int key, int x, int y)
 	Game().specialKeyboardEvent(key, x, y);
 }
 
+static void keyboardUpEventCallback(unsigned char key, int x, int y)
+{
+	Game().keyboardUpEvent(key, x, y);
+}
+
+static void specialKeyboardUpEventCallback(int key, int x, int y)
+{
+	Game().specialKeyboardUpEvent(key, x, y);
+}
+
+  // GLUT waits for us, so the frame schedule only says how long to ask
+  // it to wait (to the nearest ms, all a GLUT timer can do)
 void GameController::timerFuncCallback(int)
 {
+	Scheduler& frames = Game().m_frameSchedule;
+	frames.wokeUp();
 	Game().doSomething();
-    glutTimerFunc(MS_PER_FRAME, timerFuncCallback, 0);
+	int ms = static_cast<int>(lround(chrono::duration<double, milli>(frames.waitTime()).count()));
+	glutTimerFunc(ms, timerFuncCallback, 0);
+}
+
+GameController::GameController()
+ : m_tickSchedule(1000.0 / DEFAULT_MS_PER_TICK), m_frameSchedule(1000.0 / DEFAULT_MS_PER_FRAME)
+{
+}
+
+static void reportSchedule(string what, const Scheduler& schedule)
+{
+	cout << what << " at " << schedule.getRate() << "/s: " << schedule.getWakeups() << " woke "
+		 << schedule.getAverageJitter() << " ms late on average, " << schedule.getMaxJitter()
+		 << " ms at worst; " << schedule.getOverruns() << " overran" << endl;
 }
 
 void GameController::run(int argc, char* argv[], GameWorld* gw, string windowTitle)
 {
 	gw->setController(this);
+	if (!m_recordPath.empty())
+		gw->recordTo(&m_replay);
 	m_gw = gw;
+	TRACE_THREAD_NAME("GLUT");
+	m_stateEntered = chrono::steady_clock::now();
 	setGameState(welcome);
-	m_lastKeyHit = INVALID_KEY;
 	m_singleStep = false;
-	m_curIntraFrameTick = 0;
+	m_quitRequested = false;
 	m_playerWon = false;
+	m_gameStatVersion = 0;
+	m_statTextList = 0;
+	m_statTextListVersion = -1;
+	m_simRunning = false;
+	m_simExit = false;
+	m_simFinished = false;
+	m_simStatus = GWSTATUS_CONTINUE_GAME;
+#ifdef GR_PROFILE
+	m_lastDrawNs = 0;
+	m_showProfile = false;
+	for (int k = 0; k < NUM_PROFILE_PHASES; k++)
+		m_profileAverage[k] = 0;
+	if (!m_profilePath.empty()  &&  !m_profileLog.open(m_profilePath))
+		cout << "Cannot write profile file " << m_profilePath << endl;
+#endif
+	m_simThread = thread(&GameController::simulate, this);
 
 	glutInit(&argc, argv);
 
@@ -165,70 +223,171 @@ void GameController::run(int argc, char* argv[], GameWorld* gw, string windowTit
 
 	glutKeyboardFunc(keyboardEventCallback);
 	glutSpecialFunc(specialKeyboardEventCallback);
+	glutKeyboardUpFunc(keyboardUpEventCallback);
+	glutSpecialUpFunc(specialKeyboardUpEventCallback);
 	glutReshapeFunc(reshapeCallback);
 	glutDisplayFunc(doSomethingCallback);
-	glutTimerFunc(MS_PER_FRAME, timerFuncCallback, 0);
+	m_frameSchedule.start();
+	glutTimerFunc(static_cast<int>(lround(chrono::duration<double, milli>(m_frameSchedule.waitTime()).count())),
+				  timerFuncCallback, 0);
 
 	glutSetOption(GLUT_ACTION_ON_WINDOW_CLOSE, GLUT_ACTION_GLUTMAINLOOP_RETURNS);
 	glutMainLoop();
+
+	{
+		lock_guard<mutex> lock(m_simMutex);
+		m_simExit = true;
+	}
+	m_simWake.notify_one();
+	m_simThread.join();
+#ifdef GR_PROFILE
+	m_profileLog.close();
+#endif
+	TRACE_SPAN(STATE_NAMES[m_gameState], "state", m_stateEntered, chrono::steady_clock::now());
+
+	reportSchedule("Ticks", m_tickSchedule);
+	reportSchedule("Frames", m_frameSchedule);
+	if (m_gw->getKeysTaken() > 0)
+		cout << "Key delay: " << m_gw->getAverageKeyDelay() << " ms average, "
+			 << m_gw->getMaxKeyDelay() << " ms worst, over " << m_gw->getKeysTaken() << " keys" << endl;
+
+	if (!m_recordPath.empty())
+	{
+		m_replay.finish(m_gw->getTicks(), m_gw->getScore());
+		if (!m_replay.save(m_recordPath))
+			cout << "Cannot write replay file " << m_recordPath << endl;
+		else
+			cout << "Recorded " << m_gw->getTicks() << " ticks to " << m_recordPath << endl;
+	}
 	delete m_gw;
 }
 
+  // The game's key for a GLUT key, or INVALID_KEY for one it doesn't use
+static int gameKey(unsigned char key)
+{
+	switch (key)
+	{
+		case 'a': case '4': return KEY_PRESS_LEFT;
+		case 'd': case '6': return KEY_PRESS_RIGHT;
+		case 'w': case '8': return KEY_PRESS_UP;
+		case 's': case '2': return KEY_PRESS_DOWN;
+		case 't':			return KEY_PRESS_TAB;
+		default:			return key;
+	}
+}
+
+static int gameSpecialKey(int key)
+{
+	switch (key)
+	{
+		case GLUT_KEY_LEFT:	 return KEY_PRESS_LEFT;
+		case GLUT_KEY_RIGHT: return KEY_PRESS_RIGHT;
+		case GLUT_KEY_UP:	 return KEY_PRESS_UP;
+		case GLUT_KEY_DOWN:	 return KEY_PRESS_DOWN;
+		default:			 return INVALID_KEY;
+	}
+}
+
 void GameController::keyboardEvent(unsigned char key, int /* x */, int /* y */)
 {
 	switch (key)
 	{
-		case 'a': case '4': m_lastKeyHit = KEY_PRESS_LEFT;	break;
-		case 'd': case '6': m_lastKeyHit = KEY_PRESS_RIGHT; break;
-		case 'w': case '8': m_lastKeyHit = KEY_PRESS_UP;	break;
-		case 's': case '2': m_lastKeyHit = KEY_PRESS_DOWN;	break;
-		case 't':			m_lastKeyHit = KEY_PRESS_TAB;	break;
 		case 'f':			m_singleStep = true;			break;
 		case 'r':			m_singleStep = false;			break;
 		case 'q': case 'Q': setGameState(quit);				break;
-		default:			m_lastKeyHit = key;				break;
+		default:			pushKeyEvent(gameKey(key), true); break;
 	}
 }
 
 void GameController::specialKeyboardEvent(int key, int /* x */, int /* y */)
+{
+#ifdef GR_PROFILE
+	  // F1 isn't a game key, so the overlay doesn't take input from the game
+	if (key == GLUT_KEY_F1)
+	{
+		m_showProfile = !m_showProfile;
+		return;
+	}
+#endif
+	pushKeyEvent(gameSpecialKey(key), true);
+}
+
+void GameController::keyboardUpEvent(unsigned char key, int /* x */, int /* y */)
 {
 	switch (key)
 	{
-		case GLUT_KEY_LEFT:	 m_lastKeyHit = KEY_PRESS_LEFT;	 break;
-		case GLUT_KEY_RIGHT: m_lastKeyHit = KEY_PRESS_RIGHT; break;
-		case GLUT_KEY_UP:	 m_lastKeyHit = KEY_PRESS_UP;	 break;
-		case GLUT_KEY_DOWN:	 m_lastKeyHit = KEY_PRESS_DOWN;	 break;
-		default:			 m_lastKeyHit = INVALID_KEY;	 break;
+		case 'f': case 'r': case 'q': case 'Q':				break;
+		default:			pushKeyEvent(gameKey(key), false); break;
 	}
 }
 
-void GameController::playSound(int soundID)
+void GameController::specialKeyboardUpEvent(int key, int /* x */, int /* y */)
 {
-	if (soundID == SOUND_NONE)
-		return;
+	pushKeyEvent(gameSpecialKey(key), false);
+}
 
-	SoundMapType::const_iterator p = m_soundMap.find(soundID);
-	if (p != m_soundMap.end())
+  // Called only from the GLUT thread, so the queue has one producer.  If
+  // nobody has taken events for so long that it's full, the new one is
+  // dropped.
+void GameController::pushKeyEvent(int key, bool pressed)
+{
+	if (key != INVALID_KEY)
+		m_keyEvents.push(KeyEvent{ key, pressed, chrono::steady_clock::now() });
+}
+
+  // Takes key events up to and including the next press, for the
+  // controller's own use (prompts and single-stepping); like
+  // getKeyEvent(), only from the thread that owns the world
+bool GameController::getKeyPress(int& key)
+{
+	KeyEvent event;
+	while (m_keyEvents.pop(event))
 	{
-		string path = m_gw->assetPath();
-		if (!path.empty())
-			path += '/';
-		SoundFX().playClip(path + p->second);
+		if (event.pressed)
+		{
+			key = event.key;
+			return true;
+		}
 	}
+	return false;
+}
+
+  // The world calls this from the simulation thread; the mixer just
+  // queues the sound, so the tick never waits on it.
+void GameController::playSound(int soundID)
+{
+	if (soundID >= 0  &&  soundID < NUM_SOUND_IDS)
+		SoundFX().playClip(m_soundClips[soundID]);
+}
+
+void GameController::abortSounds()
+{
+	SoundFX().abortClip();
 }
 
 void GameController::setGameState(GameControllerState s)
 {
+	  // Each state the controller passes through is a span in the trace
+	if (m_gameState != quit  &&  s != m_gameState)
+	{
+		chrono::steady_clock::time_point now = chrono::steady_clock::now();
+		TRACE_SPAN(STATE_NAMES[m_gameState], "state", m_stateEntered, now);
+		m_stateEntered = now;
+	}
     if (m_gameState != quit)
         m_gameState = s;
 }
+  // The world may call this from the simulation thread, so just flag it
 void GameController::quitGame()
 {
-    setGameState(quit);
+    m_quitRequested = true;
 }
 
 void GameController::doSomething()
 {
+	if (m_quitRequested)
+		setGameState(quit);
+
 	switch (m_gameState)
 	{
 		case not_applicable:
@@ -253,40 +412,30 @@ void GameController::doSomething()
 			m_nextStateAfterPrompt = cleanup;
 			break;
 		case makemove:
-			m_curIntraFrameTick = ANIMATION_POSITIONS_PER_TICK;
-			m_nextStateAfterAnimate = not_applicable;
 			{
-				int status = m_gw->move();
-				if (status == GWSTATUS_PLAYER_DIED)
+				  // Check before drawing, so the last tick of the level is
+				  // drawn before we move on
+				bool finished = m_simFinished;
+				if (m_snapshots.update())
+					displayGamePlay();
+				if (finished)
 				{
-					  // animate one last frame so the Ego can see what happened
-					m_nextStateAfterAnimate = (m_gw->isGameOver() ? gameover : contgame);
-				}
-				else if (status == GWSTATUS_FINISHED_LEVEL)
-				{
-					m_gw->advanceToNextLevel();
-					  // animate one last frame so the Ego can see what happened
-					m_nextStateAfterAnimate = finishedlevel;
+					int status = m_simStatus;
+					if (status == GWSTATUS_PLAYER_DIED)
+						setGameState(m_gw->isGameOver() ? gameover : contgame);
+					else if (status == GWSTATUS_FINISHED_LEVEL)
+					{
+						m_gw->advanceToNextLevel();
+						setGameState(finishedlevel);
+					}
 				}
 			}
-			setGameState(animate);
 			break;
-		case animate:
-			displayGamePlay();
-			if (m_curIntraFrameTick-- <= 0)
+		case cleanup:
 			{
-				if (m_nextStateAfterAnimate != not_applicable)
-					setGameState(m_nextStateAfterAnimate);
-				else
-				{
-					int key;
-					if (!m_singleStep  ||  getLastKey(key))
-						setGameState(makemove);
-				}
+				TRACE_SCOPE("cleanUp");
+				m_gw->cleanUp();
 			}
-			break;
-		case cleanup:
-			m_gw->cleanUp();
 			setGameState(init);
 			break;
 		case gameover:
@@ -304,14 +453,18 @@ void GameController::doSomething()
 			drawPrompt(m_mainMessage, m_secondMessage);
 			{
 				int key;
-				if (getLastKey(key) && key == '\r')
+				if (getKeyPress(key) && key == '\r')
 					setGameState(m_nextStateAfterPrompt);
 			}
 			break;
 		case init:
 			{
-				int status = m_gw->init();
-				SoundFX().abortClip();
+				int status;
+				{
+					TRACE_SCOPE("init");
+					status = m_gw->init();
+				}
+				abortSounds();
 				if (status == GWSTATUS_PLAYER_WON)
 				{
 					m_playerWon = true;
@@ -325,18 +478,133 @@ void GameController::doSomething()
 					m_nextStateAfterPrompt = quit;
 				}
 				else
+				{
+					publishSnapshot();
+					startSimulation();
 					setGameState(makemove);
+				}
 			}
 			break;
 		case quit:
-            SoundFX().abortClip();
+            abortSounds();
 			glutLeaveMainLoop();
 			break;
 	}
 }
 
 
+void GameController::startSimulation()
+{
+	m_simFinished = false;
+	{
+		lock_guard<mutex> lock(m_simMutex);
+		m_simRunning = true;
+	}
+	m_simWake.notify_one();
+}
+
+  // Body of the simulation thread: play a level each time startSimulation()
+  // asks for one, until run() is done.
+void GameController::simulate()
+{
+	TRACE_THREAD_NAME("simulation");
+	unique_lock<mutex> lock(m_simMutex);
+	for (;;)
+	{
+		m_simWake.wait(lock, [this] { return m_simRunning  ||  m_simExit; });
+		if (m_simExit)
+			return;
+		lock.unlock();
+		m_simStatus = runLevel();
+		lock.lock();
+		m_simRunning = false;
+		m_simFinished = true;
+	}
+}
+
+  // Tick the world on m_tickSchedule until a tick ends the level (or the
+  // game is quit), and return the status of that last tick
+int GameController::runLevel()
+{
+	m_tickSchedule.start();
+	while (!m_simExit  &&  !m_quitRequested)
+	{
+		if (m_singleStep)
+		{
+			int key;
+			while (m_singleStep  &&  !getKeyPress(key)  &&  !m_simExit  &&  !m_quitRequested)
+				this_thread::sleep_for(m_frameSchedule.getPeriod());
+			m_tickSchedule.restartNow();
+		}
+		m_tickSchedule.sleepUntilNext();
+
+		int status = m_gw->runTick();
+#ifdef GR_PROFILE
+		ProfileTimes times = Profiler::takeTimes();
+		times.ns[PROFILE_DRAW] = m_lastDrawNs.load(memory_order_relaxed);	// of the latest frame
+		m_profileLog.writeRow(m_gw->getTicks(), times);
+		m_snapshots.writeBuffer().profile = times;
+#endif
+		publishSnapshot();
+		if (status != GWSTATUS_CONTINUE_GAME)
+			return status;
+	}
+	return GWSTATUS_CONTINUE_GAME;
+}
+
+  // Called by whichever thread currently owns the world
+void GameController::publishSnapshot()
+{
+	TRACE_SCOPE("publish snapshot");
+	RenderSnapshot& snapshot = m_snapshots.writeBuffer();
+	for (int i = 0; i < RenderSnapshot::NUM_DEPTHS; i++)
+	{
+		vector<RenderSprite>& sprites = snapshot.sprites[i];
+		sprites.clear();
+		const vector<GraphObject*>& graphObjects = m_gw->getGraphObjects().getGraphObjects(i);
+		for (size_t k = 0; k < graphObjects.size(); k++)
+		{
+			GraphObject* cur = graphObjects[k];
+			if (cur->isVisible())
+			{
+				cur->animate();
+
+				RenderSprite s;
+				s.imageID = cur->getID();
+				s.animationNumber = cur->getAnimationNumber();
+				cur->getAnimationLocation(s.x, s.y);
+				s.direction = cur->getDirection();
+				s.size = cur->getSize();
+				sprites.push_back(s);
+			}
+		}
+	}
+	snapshot.roadOffset = m_gw->getRoadOffset();
+	if (snapshot.gameStatVersion != m_gameStatVersion)
+	{
+		snapshot.gameStatText = m_gameStatText;
+		snapshot.gameStatVersion = m_gameStatVersion;
+	}
+	m_snapshots.publish();
+}
+
 void GameController::displayGamePlay()
+{
+	const RenderSnapshot& snapshot = m_snapshots.readBuffer();
+	{
+		PROFILE_SCOPE(PROFILE_DRAW);
+		drawWorld(snapshot);
+	}
+#ifdef GR_PROFILE
+	m_lastDrawNs.store(Profiler::takeTimes().ns[PROFILE_DRAW], memory_order_relaxed);
+	if (m_showProfile)
+		drawProfile(snapshot.profile);
+#endif
+	TRACE_SCOPE("swap buffers");
+	glutSwapBuffers();
+}
+
+void GameController::drawWorld(const RenderSnapshot& snapshot)
 {
 	glEnable(GL_DEPTH_TEST); // must be done each time before displaying graphics or gets disabled for some reason
 	glLoadIdentity();
@@ -350,32 +618,100 @@ void GameController::displayGamePlay()
 #pragma GCC diagnostic pop
 #endif
 
-	for (int i = 4 /* NUM_DEPTHS */ - 1; i >= 0; --i)
+	  // Deepest layer first; in each layer, the road stripes go under the
+	  // objects
+	m_spriteManager.beginBatch();
+	int drawOrder = 0;
+	for (int i = RenderSnapshot::NUM_DEPTHS - 1; i >= 0; --i)
 	{
-		std::set<GraphObject*> &graphObjects = GraphObject::getGraphObjects(i);
+		drawRoadStripes(i, snapshot.roadOffset, drawOrder++);
 
-		for (auto it = graphObjects.begin(); it != graphObjects.end(); it++)
+		const vector<RenderSprite>& sprites = snapshot.sprites[i];
+		for (size_t k = 0; k < sprites.size(); k++)
 		{
-			GraphObject* cur = *it;
-			if (cur->isVisible())
-			{
-				cur->animate();
-
-				double x, y, gx, gy, gz;
-				cur->getAnimationLocation(x, y);
-				convertToGlutCoords(x, y, gx, gy, gz);
+			const RenderSprite& cur = sprites[k];
 
-				int angle = cur->getDirection();
-				int imageID = cur->getID();
+			double gx, gy, gz;
+			convertToGlutCoords(cur.x, cur.y, gx, gy, gz);
 
-				m_spriteManager.plotSprite(imageID, cur->getAnimationNumber() % m_spriteManager.getNumFrames(imageID), gx, gy, gz, angle, cur->getSize());
-			}
+			m_spriteManager.addSprite(cur.imageID, cur.animationNumber % m_spriteManager.getNumFrames(cur.imageID), gx, gy, gz, cur.direction, cur.size, drawOrder);
 		}
+		drawOrder++;
+	}
+	m_spriteManager.drawBatch();
+
+	  // Stroking the text takes a few thousand vertices, so that's done
+	  // only when the text changes; every other frame replays the list
+	if (m_statTextListVersion != snapshot.gameStatVersion)
+	{
+		if (m_statTextList == 0)
+			m_statTextList = glGenLists(1);
+		glNewList(m_statTextList, GL_COMPILE);
+		outputStrokeCentered(SCORE_Y, SCORE_Z, snapshot.gameStatText.c_str());
+		glEndList();
+		m_statTextListVersion = snapshot.gameStatVersion;
 	}
+	drawScoreAndLives(m_statTextList);
+}
 
-	drawScoreAndLives(m_gameStatText);
+#ifdef GR_PROFILE
 
-	glutSwapBuffers();
+  // A table of how long each phase has been taking, in the top left
+  // corner, on top of everything else
+void GameController::drawProfile(const ProfileTimes& times)
+{
+	static const int LINE_HEIGHT = 15;
+
+	for (int k = 0; k < NUM_PROFILE_PHASES; k++)
+		m_profileAverage[k] += (times.ns[k] - m_profileAverage[k]) / 16;
+
+	glMatrixMode(GL_PROJECTION);
+	glPushMatrix();
+	glLoadIdentity();
+	glOrtho(0, WINDOW_WIDTH, 0, WINDOW_HEIGHT, -1, 1);
+	glMatrixMode(GL_MODELVIEW);
+	glPushMatrix();
+	glLoadIdentity();
+	glDisable(GL_DEPTH_TEST);
+	glColor3f(1, 1, 0);
+
+	for (int k = 0; k < NUM_PROFILE_PHASES; k++)
+	{
+		char line[64];
+		snprintf(line, sizeof(line), "%-16s%8.3f ms", PROFILE_PHASE_NAMES[k], m_profileAverage[k] / 1e6);
+		glRasterPos2i(10, WINDOW_HEIGHT - (k + 2) * LINE_HEIGHT);
+		for (const char* p = line; *p != '\0'; p++)
+			glutBitmapCharacter(GLUT_BITMAP_9_BY_15, *p);
+	}
+
+	glPopMatrix();
+	glMatrixMode(GL_PROJECTION);
+	glPopMatrix();
+	glMatrixMode(GL_MODELVIEW);
+}
+
+#endif // GR_PROFILE
+
+void GameController::drawRoadStripes(int depth, double roadOffset, int drawOrder)
+{
+	const std::vector<RoadStripe>& stripes = m_gw->getRoadStripes();
+	for (size_t k = 0; k < stripes.size(); k++)
+	{
+		const RoadStripe& s = stripes[k];
+		if (s.depth != depth)
+			continue;
+
+		  // lowest copy on screen, then one every s.spacing pixels up the view
+		double y = fmod(roadOffset, s.spacing);
+		if (y < 0)
+			y += s.spacing;
+		for ( ; y <= VIEW_HEIGHT; y += s.spacing)
+		{
+			double gx, gy, gz;
+			convertToGlutCoords(s.x, y, gx, gy, gz);
+			m_spriteManager.addSprite(s.imageID, 0, gx, gy, gz, 0, s.size, drawOrder);
+		}
+	}
 }
 
 void GameController::reshape (int w, int h)
@@ -442,7 +778,7 @@ static void drawPrompt(string mainMessage, string secondMessage)
 	glutSwapBuffers();
 }
 
-static void drawScoreAndLives(string gameStatText)
+static void drawScoreAndLives(GLuint statTextList)
 {
 	static int RATE = 1;
 	static GLfloat rgb[3] =
@@ -457,5 +793,5 @@ static void drawScoreAndLives(string gameStatText)
 		rgb[k] = static_cast<GLfloat>(strength);
 	}
 	glColor3f(rgb[0], rgb[1], rgb[2]);
-	outputStrokeCentered(SCORE_Y, SCORE_Z, gameStatText.c_str());
+	glCallList(statTextList);
 }
@@ -2,36 +2,99 @@
 #define GAMECONTROLLER_H_
 
 #include "SpriteManager.h"
+#include "GameWorld.h"
+#include "Replay.h"
+#include "TripleBuffer.h"
+#include "RingQueue.h"
+#include "Scheduler.h"
+#include "Profiler.h"
 #include <string>
 #include <map>
+#include <vector>
 #include <iostream>
 #include <sstream>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
 const int INVALID_KEY = 0;
 
 class GraphObject;
-class GameWorld;
 
-class GameController
+  // What the GLUT thread needs to draw one tick: a copy of every visible
+  // GraphObject's looks, taken by the simulation thread right after the
+  // tick, so drawing never touches the live world.
+struct RenderSprite
+{
+	int			imageID;
+	unsigned int animationNumber;
+	double		x;
+	double		y;
+	int			direction;
+	double		size;
+};
+
+struct RenderSnapshot
+{
+	static const int NUM_DEPTHS = GraphObjectRegistry::NUM_DEPTHS;
+
+	std::vector<RenderSprite> sprites[NUM_DEPTHS];
+	double		roadOffset = 0;
+	std::string	gameStatText;
+	long		gameStatVersion = 0;	// changes whenever gameStatText does
+#ifdef GR_PROFILE
+	ProfileTimes profile = ProfileTimes();	// of the tick
+#endif
+};
+
+class GameController : public WorldController
 {
   public:
 	void run(int argc, char* argv[], GameWorld* gw, std::string windowTitle);
 
-	bool getLastKey(int& value)
+	  // How many times a second to tick the world and to draw; call before
+	  // run()
+	void setTickRate(double ticksPerSecond)
 	{
-		if (m_lastKeyHit != INVALID_KEY)
-		{
-			value = m_lastKeyHit;
-			m_lastKeyHit = INVALID_KEY;
-			return true;
-		}
-		return false;
+		m_tickSchedule.setRate(ticksPerSecond);
 	}
 
-	void playSound(int soundID);
+	void setFrameRate(double framesPerSecond)
+	{
+		m_frameSchedule.setRate(framesPerSecond);
+	}
 
-	void setGameStatText(std::string text)
+	  // Record the session run() plays into a replay file at path
+	void recordTo(std::string path)
+	{
+		m_recordPath = path;
+	}
+
+#ifdef GR_PROFILE
+	  // Write each tick's profile to a CSV file at path
+	void profileTo(std::string path)
+	{
+		m_profilePath = path;
+	}
+#endif
+
+	  // The GLUT thread pushes every key going down or up onto m_keyEvents;
+	  // whichever thread owns the world takes them: the simulation thread
+	  // while a level is being played, and the GLUT thread otherwise
+	virtual bool getKeyEvent(KeyEvent& event)
+	{
+		return m_keyEvents.pop(event);
+	}
+
+	virtual void playSound(int soundID);
+
+	  // Copies into m_gameStatText's existing buffer, so this doesn't
+	  // allocate once the text has been as long before
+	virtual void setGameStatText(const std::string& text)
 	{
 		m_gameStatText = text;
+		m_gameStatVersion++;
 	}
 
 	void doSomething();
@@ -39,8 +102,10 @@ class GameController
 	void reshape(int w, int h);
 	void keyboardEvent(unsigned char key, int x, int y);
 	void specialKeyboardEvent(int key, int x, int y);
+	void keyboardUpEvent(unsigned char key, int x, int y);
+	void specialKeyboardUpEvent(int key, int x, int y);
 
-    void quitGame();
+    virtual void quitGame();
 
 	  // Meyers singleton pattern
 	static GameController& getInstance()
@@ -50,7 +115,6 @@ class GameController
 	}
 
 	static void timerFuncCallback(int nothing);
-	void setMsPerTick(int ms_per_tick) { m_ms_per_tick = ms_per_tick;  }
 
 private:
     enum GameControllerState : int;
@@ -58,26 +122,69 @@ private:
 	GameWorld*	m_gw;
 	GameControllerState	m_gameState;
 	GameControllerState	m_nextStateAfterPrompt;
-	GameControllerState	m_nextStateAfterAnimate;
-	int			m_lastKeyHit;
-	bool		m_singleStep;
-	std::string m_gameStatText;
+	RingQueue<KeyEvent, 256> m_keyEvents;
+	std::atomic<bool>	m_singleStep;
+	std::atomic<bool>	m_quitRequested;
+	std::string m_gameStatText;		// as last set by the world
+	long		m_gameStatVersion;
+	GLuint		m_statTextList;			// display list stroking the game stat text,
+	long		m_statTextListVersion;	// made from this version of it
 	std::string m_mainMessage;
 	std::string m_secondMessage;
-	int			m_curIntraFrameTick;
-	using SoundMapType = std::map<int, std::string>;
 	using DrawMapType  = std::map<int, std::string>;
-	SoundMapType m_soundMap;
+	int			m_soundClips[NUM_SOUND_IDS];	// SoundFX handle for each sound ID, or -1
 	bool		m_playerWon;
 	SpriteManager m_spriteManager;
+	std::string	m_recordPath;
+	Replay		m_replay;
+
+	  // While a level is being played (the makemove state), the world
+	  // belongs to the simulation thread, which ticks it on m_tickSchedule
+	  // and publishes a RenderSnapshot after each tick.  It stops when a
+	  // tick ends the level, and the GLUT thread takes the world back.
+	std::thread	m_simThread;
+	std::mutex	m_simMutex;
+	std::condition_variable m_simWake;
+	bool		m_simRunning;				// guarded by m_simMutex
+	std::atomic<bool>	m_simExit;
+	std::atomic<bool>	m_simFinished;
+	int			m_simStatus;				// valid once m_simFinished
+	TripleBuffer<RenderSnapshot> m_snapshots;
+	Scheduler	m_tickSchedule;			// used by the simulation thread
+	Scheduler	m_frameSchedule;		// used by the GLUT thread
+
+#ifdef GR_PROFILE
+	std::string	m_profilePath;
+	ProfileLog	m_profileLog;			// written by the simulation thread
+	std::atomic<long long> m_lastDrawNs;
+	bool		m_showProfile;			// toggled by F1
+	double		m_profileAverage[NUM_PROFILE_PHASES];	// ns, smoothed over recent ticks
+#endif
+	std::chrono::steady_clock::time_point m_stateEntered;	// when m_gameState was set, for the trace
 
     void setGameState(GameControllerState s);
 
 	void initDrawersAndSounds();
+	void abortSounds();
+	void pushKeyEvent(int key, bool pressed);
+	bool getKeyPress(int& key);
 	void displayGamePlay();
-
-	static const int kDefaultMsPerTick = 10;
-	static int m_ms_per_tick;
+	void drawWorld(const RenderSnapshot& snapshot);
+#ifdef GR_PROFILE
+	void drawProfile(const ProfileTimes& times);
+#endif
+	void drawRoadStripes(int depth, double roadOffset, int drawOrder);
+
+	void startSimulation();
+	void simulate();
+	int runLevel();
+	void publishSnapshot();
+
+	GameController();
+
+	  // Prevent copying or assigning the GameController
+	GameController(const GameController&);
+	GameController& operator=(const GameController&);
 };
 
 inline GameController& Game()
@@ -1,32 +1,129 @@
 #include "GameWorld.h"
-#include "GameController.h"
+#include "Replay.h"
 #include <string>
 #include <cstdlib>
+#include <random>
+#include <chrono>
 using namespace std;
 
 bool GameWorld::getKey(int& value)
 {
-	bool gotKey = m_controller->getLastKey(value);
+	if (m_numPendingKeys == 0)
+		return false;
+	const KeyEvent& event = m_pendingKeys[m_firstPendingKey];
+	m_firstPendingKey = (m_firstPendingKey + 1) % MAX_PENDING_KEYS;
+	m_numPendingKeys--;
+	value = event.key;
 
-	if (gotKey)
+	double delay = chrono::duration<double, milli>(chrono::steady_clock::now() - event.time).count();
+	m_keysTaken++;
+	m_totalKeyDelay += delay;
+	if (delay > m_maxKeyDelay)
+		m_maxKeyDelay = delay;
+
+	if (value == 'q'  ||  value == '\x03')  // CTRL-C
+		m_controller->quitGame();
+	if (m_recording != nullptr)
+		m_recording->addKey(m_ticks, value);
+	return true;
+}
+
+void GameWorld::takeKeyEvents()
+{
+	KeyEvent event;
+	while (m_controller->getKeyEvent(event))
 	{
-		if (value == 'q'  ||  value == '\x03')  // CTRL-C
-			m_controller->quitGame();
+		if (!event.pressed)
+			continue;
+
+		  // If presses pile up faster than they're gotten, the oldest is
+		  // the least worth acting on now
+		if (m_numPendingKeys == MAX_PENDING_KEYS)
+		{
+			m_firstPendingKey = (m_firstPendingKey + 1) % MAX_PENDING_KEYS;
+			m_numPendingKeys--;
+		}
+		m_pendingKeys[(m_firstPendingKey + m_numPendingKeys) % MAX_PENDING_KEYS] = event;
+		m_numPendingKeys++;
 	}
-	return gotKey;
 }
 
+void GameWorld::recordTo(Replay* replay)
+{
+	m_recording = replay;
+	if (m_recording != nullptr)
+		m_recording->start(getSeed(), getLevel());
+}
+
+  // How often each sound may start, and which ones win when more are asked
+  // for in one tick than MAX_SOUNDS_PER_TICK.  Sounds that only add to the
+  // din when repeated (zombies grunting, skidding) are held back the most;
+  // ones that tell the player something important always get through.
+struct SoundLimit
+{
+	int	minTicksApart;
+	int	priority;		// higher plays first
+};
+
+static const SoundLimit SOUND_LIMITS[NUM_SOUND_IDS] = {
+	{ 0, 3 },	// SOUND_PLAYER_DIE
+	{ 3, 1 },	// SOUND_PED_DIE
+	{ 3, 1 },	// SOUND_PED_HURT
+	{ 0, 2 },	// SOUND_PLAYER_SPRAY
+	{ 6, 1 },	// SOUND_OIL_SLICK
+	{ 0, 3 },	// SOUND_FINISHED_LEVEL
+	{ 3, 1 },	// SOUND_VEHICLE_DIE
+	{ 3, 1 },	// SOUND_VEHICLE_HURT
+	{ 3, 2 },	// SOUND_VEHICLE_CRASH
+	{ 0, 3 },	// SOUND_THEME
+	{ 2, 2 },	// SOUND_GOT_GOODIE
+	{ 2, 2 },	// SOUND_GOT_SOUL
+	{ 8, 0 },	// SOUND_ZOMBIE_ATTACK
+};
+
 void GameWorld::playSound(int soundID)
 {
-	m_controller->playSound(soundID);
+	if (soundID < 0  ||  soundID >= NUM_SOUND_IDS)
+		return;
+	m_soundRequests[soundID]++;
+	m_soundsRequested++;
+}
+
+  // Play each sound asked for this tick once, unless it played too
+  // recently, and no more than MAX_SOUNDS_PER_TICK of them, highest
+  // priority first.  Whatever doesn't make it is dropped, not put off: a
+  // sound late by a tick or more no longer matches what's on the screen.
+void GameWorld::flushSounds()
+{
+	for (int played = 0; played < MAX_SOUNDS_PER_TICK; played++)
+	{
+		int best = SOUND_NONE;
+		for (int k = 0; k < NUM_SOUND_IDS; k++)
+		{
+			if (m_soundRequests[k] > 0  &&  m_ticks - m_lastTickPlayed[k] >= SOUND_LIMITS[k].minTicksApart  &&
+				(best == SOUND_NONE  ||  SOUND_LIMITS[k].priority > SOUND_LIMITS[best].priority))
+				best = k;
+		}
+		if (best == SOUND_NONE)
+			break;
+		m_soundRequests[best] = 0;
+		m_lastTickPlayed[best] = m_ticks;
+		m_soundsPlayed++;
+		m_controller->playSound(best);
+	}
+
+	for (int k = 0; k < NUM_SOUND_IDS; k++)
+		m_soundRequests[k] = 0;
 }
 
-void GameWorld::setGameStatText(string text)
+void GameWorld::setGameStatText(const string& text)
 {
 	m_controller->setGameStatText(text);
 }
 
-void GameWorld::setMsPerTick(int ms_per_tick)
+  // A seed for a world nobody asked to be reproducible
+std::uint64_t GameWorld::newSeed()
 {
-	m_controller->setMsPerTick(ms_per_tick);
+	std::random_device rd;
+	return (std::uint64_t(rd()) << 32) | rd();
 }
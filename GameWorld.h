@@ -2,20 +2,73 @@
 #define GAMEWORLD_H_
 
 #include "GameConstants.h"
+#include "RandomGenerator.h"
+#include "GraphObject.h"
+#include "Profiler.h"
 #include <string>
+#include <vector>
+#include <chrono>
+#include <cstdint>
 
 const int START_PLAYER_LIVES = 3;
 
-class GameController;
+class Replay;
+
+  // A key going down or coming back up, stamped with when the controller
+  // saw it (so how long it waited for a tick to use it can be measured)
+struct KeyEvent
+{
+	int		key;		// KEY_PRESS_LEFT, etc., or the character typed
+	bool	pressed;	// false if released
+	std::chrono::steady_clock::time_point time;
+};
+
+  // Everything a world needs from whatever is driving it: the GLUT-based
+  // GameController for interactive play, or a headless driver that runs
+  // the simulation with no window, sound, or sprites.
+class WorldController
+{
+public:
+	virtual ~WorldController()
+	{
+	}
+
+	  // The oldest key event not yet taken, if any.  Only the thread that
+	  // owns the world (the one calling runTick()) may take events.
+	virtual bool getKeyEvent(KeyEvent& event) = 0;
+	virtual void playSound(int soundID) = 0;
+	virtual void setGameStatText(const std::string& text) = 0;
+	virtual void quitGame() = 0;
+};
+
+  // A column of copies of one sprite, spaced evenly up the whole view and
+  // scrolled by the world's road offset (e.g., a painted lane marking).
+  // These are drawn by the framework; they are not GraphObjects.
+struct RoadStripe
+{
+	int		imageID;
+	double	x;
+	double	spacing;	// distance between the centers of neighboring copies
+	double	size;
+	int		depth;
+};
 
 class GameWorld
 {
 public:
 
 	GameWorld(std::string assetPath)
-	 : m_lives(START_PLAYER_LIVES), m_score(0), m_level(1),
-	   m_controller(nullptr), m_assetPath(assetPath)
+	 : m_lives(START_PLAYER_LIVES), m_score(0), m_level(1), m_roadOffset(0),
+	   m_random(newSeed()), m_ticks(0), m_recording(nullptr), m_controller(nullptr),
+	   m_assetPath(assetPath), m_soundsRequested(0), m_soundsPlayed(0),
+	   m_firstPendingKey(0), m_numPendingKeys(0),
+	   m_keysTaken(0), m_totalKeyDelay(0), m_maxKeyDelay(0)
 	{
+		for (int k = 0; k < NUM_SOUND_IDS; k++)
+		{
+			m_soundRequests[k] = 0;
+			m_lastTickPlayed[k] = NEVER_PLAYED;
+		}
 	}
 
 	virtual ~GameWorld()
@@ -26,9 +79,16 @@ public:
 	virtual int move() = 0;
 	virtual void cleanUp() = 0;
 
-	void setGameStatText(std::string text);
+	void setGameStatText(const std::string& text);
 
+	  // Returns the oldest key press not yet gotten.  Presses are queued,
+	  // so several hit between two ticks come back on the ticks that follow
+	  // rather than only the last of them.
 	bool getKey(int& value);
+
+	  // Sounds asked for during a tick are only collected; at the end of
+	  // the tick, each sound asked for plays once, within limits (see
+	  // flushSounds()).
 	void playSound(int soundID);
 
 	int getLevel() const
@@ -61,8 +121,53 @@ public:
 		m_score += howMuch;
 	}
 
+	  // Return a uniformly distributed random int from min to max, inclusive.
+	  // Each world has its own generator, so a world's run is reproducible
+	  // from its seed.
+	int randInt(int min, int max)
+	{
+		return m_random.randInt(min, max);
+	}
+
+	void setSeed(std::uint64_t seed)
+	{
+		m_random.setSeed(seed);
+	}
+
+	std::uint64_t getSeed() const
+	{
+		return m_random.getSeed();
+	}
+
+	void addRoadStripe(int imageID, double x, double spacing, double size, int depth)
+	{
+		RoadStripe stripe = { imageID, x, spacing, size, depth };
+		m_roadStripes.push_back(stripe);
+	}
+
+	void setRoadOffset(double y)
+	{
+		m_roadOffset = y;
+	}
+
+	double getRoadOffset() const
+	{
+		return m_roadOffset;
+	}
+
 	  // The following should be used by only the framework, not the student
 
+	const std::vector<RoadStripe>& getRoadStripes() const
+	{
+		return m_roadStripes;
+	}
+
+	  // Every GraphObject in this world; pass it to the GraphObject constructor
+	GraphObjectRegistry& getGraphObjects()
+	{
+		return m_graphObjects;
+	}
+
 	bool isGameOver() const
 	{
 		return m_lives == 0;
@@ -73,23 +178,104 @@ public:
 		++m_level;
 	}
  
-	void setController(GameController* controller)
+	void setController(WorldController* controller)
 	{
 		m_controller = controller;
 	}
 
+	  // Calls move(), counts the tick, takes the tick's input, and plays the
+	  // tick's sounds; drivers should call this rather than move() so
+	  // recorded keys line up with the ticks they were used on
+	int runTick()
+	{
+		PROFILE_SCOPE(PROFILE_TICK);
+		m_ticks++;
+		takeKeyEvents();
+		int status = move();
+		flushSounds();
+		return status;
+	}
+
+	long getTicks() const
+	{
+		return m_ticks;
+	}
+
+	  // Starts recording this world's seed, level, and every key getKey()
+	  // returns into replay (or stops recording, if replay is nullptr)
+	void recordTo(Replay* replay);
+
 	std::string assetPath() const
 	{
 		return m_assetPath;
 	}
 
-	void setMsPerTick(int ms_per_tick);
+	  // How many times playSound() was called, and how many sounds were
+	  // actually passed on to the controller
+	long getSoundsRequested() const
+	{
+		return m_soundsRequested;
+	}
+
+	long getSoundsPlayed() const
+	{
+		return m_soundsPlayed;
+	}
+
+	  // How many key presses getKey() has returned, and how long they
+	  // waited, from when the controller saw each to when getKey() returned
+	  // it, in milliseconds
+	long getKeysTaken() const
+	{
+		return m_keysTaken;
+	}
+
+	double getAverageKeyDelay() const
+	{
+		return m_keysTaken == 0 ? 0 : m_totalKeyDelay / m_keysTaken;
+	}
+
+	double getMaxKeyDelay() const
+	{
+		return m_maxKeyDelay;
+	}
+
 private:
+	static const int MAX_SOUNDS_PER_TICK = 4;
+	static const long NEVER_PLAYED = -1000000;
+	static const int MAX_PENDING_KEYS = 32;
+
+	static std::uint64_t newSeed();
+	void flushSounds();
+
+	  // Collects every key event the controller has for us: presses are
+	  // queued for getKey(), and releases are dropped, since nothing in the
+	  // game acts on a key coming back up.  runTick() calls
+	  // this before move(), so a tick sees exactly the input that arrived
+	  // before it started.
+	void takeKeyEvents();
+
 	int				m_lives;
 	int				m_score;
 	int				m_level;
-	GameController* m_controller;
+	double			m_roadOffset;
+	RandomGenerator	m_random;
+	GraphObjectRegistry m_graphObjects;
+	long			m_ticks;
+	Replay*			m_recording;
+	std::vector<RoadStripe> m_roadStripes;
+	WorldController* m_controller;
 	std::string		m_assetPath;
+	int				m_soundRequests[NUM_SOUND_IDS];		// this tick
+	long			m_lastTickPlayed[NUM_SOUND_IDS];
+	long			m_soundsRequested;
+	long			m_soundsPlayed;
+	KeyEvent		m_pendingKeys[MAX_PENDING_KEYS];	// presses not yet gotten,
+	int				m_firstPendingKey;					// in a circular buffer
+	int				m_numPendingKeys;
+	long			m_keysTaken;
+	double			m_totalKeyDelay;	// ms
+	double			m_maxKeyDelay;		// ms
 };
 
 #endif // GAMEWORLD_H_
@@ -1,14 +1,43 @@
 #ifndef GRAPHOBJ_H_
 #define GRAPHOBJ_H_
 
-#include "SpriteManager.h"
 #include "GameConstants.h"
+#include "AngleTable.h"
 
-#include <set>
+#include <vector>
 #include <cmath>
 
 const int ANIMATION_POSITIONS_PER_TICK = 1;
 
+class GraphObject;
+
+  // Every GraphObject of one world, by depth.  Each GameWorld owns one, so
+  // any number of worlds can exist (and run on different threads) at once.
+  // Each layer is a dense array; an object remembers its position in it, so
+  // adding and removing are O(1) (removal moves the last object into the
+  // hole, so order within a layer is arbitrary).
+class GraphObjectRegistry
+{
+  public:
+	static const int NUM_DEPTHS = 4;
+
+	const std::vector<GraphObject*>& getGraphObjects(unsigned int layer) const
+	{
+		return m_graphObjects[layerIndex(layer)];
+	}
+
+	void add(GraphObject* go);
+	void remove(GraphObject* go);
+
+  private:
+	std::vector<GraphObject*> m_graphObjects[NUM_DEPTHS];
+
+	static unsigned int layerIndex(unsigned int layer)
+	{
+		return layer < NUM_DEPTHS ? layer : 0;
+	}
+};
+
 class GraphObject
 {
   public:
@@ -18,21 +47,21 @@ class GraphObject
 	static const int up = 90;
 	static const int down = 270;
 
-	GraphObject(int imageID, double startX, double startY, int dir = 0, double size = 1.0, unsigned int depth = 0)
-	 : m_imageID(imageID), m_visible(true), m_x(startX), m_y(startY),
+	GraphObject(GraphObjectRegistry& registry, int imageID, double startX, double startY, int dir = 0, double size = 1.0, unsigned int depth = 0)
+	 : m_registry(registry), m_registryIndex(0), m_imageID(imageID), m_visible(true), m_x(startX), m_y(startY),
 	   m_destX(startX), m_destY(startY), m_brightness(1.0),
 	   m_animationNumber(0), m_direction(dir), m_size(size), m_depth(depth)
 	{
 		if (m_size <= 0)
 			m_size = 1;
 
-		getGraphObjects(m_depth).insert(this);
+		m_registry.add(this);
 		setVisible(true);
 	}
 
 	virtual ~GraphObject()
 	{
-		getGraphObjects(m_depth).erase(this);
+		m_registry.remove(this);
 	}
 
 	void setVisible(bool shouldIDisplay)
@@ -75,9 +104,8 @@ class GraphObject
 
 	virtual void getPositionInThisDirection(int angle, int units, double &dx, double &dy)
 	{
-		static const double PI = 4 * atan(1.0);
-		dx = (getX() + units * cos(angle*1.0 / 360 * 2 * PI));
-		dy = (getY() + units * sin(angle*1.0 / 360 * 2 * PI));
+		dx = (getX() + units * cosDegrees(angle));
+		dy = (getY() + units * sinDegrees(angle));
 	}
 
 	void moveForward(int units = 1)
@@ -146,15 +174,6 @@ class GraphObject
 	//	moveALittle(m_y, m_destY);
 	}
 
-	static std::set<GraphObject*>& getGraphObjects(unsigned int layer)
-	{
-		static std::set<GraphObject*> graphObjects[NUM_DEPTHS];
-		if (layer < NUM_DEPTHS)
-			return graphObjects[layer];
-		else
-			return graphObjects[0];		// empty;
-	}
-
 	void increaseAnimationNumber()
 	{
 		m_animationNumber++;
@@ -163,6 +182,7 @@ class GraphObject
 
 private:
 	friend class GameController;
+	friend class GraphObjectRegistry;
 	unsigned int getID() const
 	{
 		return m_imageID;
@@ -173,7 +193,8 @@ private:
 	GraphObject(const GraphObject&);
 	GraphObject& operator=(const GraphObject&);
 
-	static const int NUM_DEPTHS = 4;
+	GraphObjectRegistry& m_registry;
+	size_t	m_registryIndex;	// where this is in its registry layer
 	int		m_imageID;
 	bool	m_visible;
 	double	m_x;
@@ -200,4 +221,20 @@ private:
 
 };
 
+inline void GraphObjectRegistry::add(GraphObject* go)
+{
+	std::vector<GraphObject*>& layer = m_graphObjects[layerIndex(go->m_depth)];
+	go->m_registryIndex = layer.size();
+	layer.push_back(go);
+}
+
+inline void GraphObjectRegistry::remove(GraphObject* go)
+{
+	std::vector<GraphObject*>& layer = m_graphObjects[layerIndex(go->m_depth)];
+	GraphObject* last = layer.back();
+	layer[go->m_registryIndex] = last;
+	last->m_registryIndex = go->m_registryIndex;
+	layer.pop_back();
+}
+
 #endif // GRAPHOBJ_H_
@@ -0,0 +1,81 @@
+#ifndef HEADLESSCONTROLLER_H_
+#define HEADLESSCONTROLLER_H_
+
+#include "GameWorld.h"
+#include "AudioMixer.h"
+#include "RingQueue.h"
+#include <string>
+#include <chrono>
+#include <algorithm>
+
+  // Drives a GameWorld with no window, no sprites and no sound, so the
+  // simulation can be stepped as fast as the CPU allows.  Sounds are only
+  // counted, unless an AudioMixer is given to play them on.  Keys are fed in
+  // by the driver with pressKey(); the world takes them at the start of the
+  // next tick, just like keys hit between two GLUT ticks.
+
+class HeadlessController : public WorldController
+{
+  public:
+	HeadlessController()
+	 : m_soundsPlayed(0), m_quitRequested(false), m_mixer(nullptr)
+	{
+	}
+
+	virtual bool getKeyEvent(KeyEvent& event)
+	{
+		return m_keyEvents.pop(event);
+	}
+
+	virtual void playSound(int soundID)
+	{
+		if (soundID == SOUND_NONE)
+			return;
+		m_soundsPlayed++;
+		if (m_mixer != nullptr  &&  soundID >= 0  &&  soundID < NUM_SOUND_IDS)
+			m_mixer->play(m_clips[soundID]);
+	}
+
+	virtual void setGameStatText(const std::string&)
+	{
+	}
+
+	virtual void quitGame()
+	{
+		m_quitRequested = true;
+	}
+
+	  // clips[soundID] is that sound's clip in mixer, or -1
+	void setMixer(AudioMixer* mixer, const int clips[NUM_SOUND_IDS])
+	{
+		m_mixer = mixer;
+		std::copy(clips, clips + NUM_SOUND_IDS, m_clips);
+	}
+
+	  // A press and release together, as from a key tapped once
+	void pressKey(int key)
+	{
+		std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		m_keyEvents.push(KeyEvent{ key, true, now });
+		m_keyEvents.push(KeyEvent{ key, false, now });
+	}
+
+	long soundsPlayed() const
+	{
+		return m_soundsPlayed;
+	}
+
+	bool quitRequested() const
+	{
+		return m_quitRequested;
+	}
+
+  private:
+	RingQueue<KeyEvent, 64> m_keyEvents;
+	long	m_soundsPlayed;
+	bool	m_quitRequested;
+	AudioMixer*			m_mixer;
+	int					m_clips[NUM_SOUND_IDS];
+};
+
+#endif // HEADLESSCONTROLLER_H_
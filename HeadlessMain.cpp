@@ -0,0 +1,385 @@
+#include "HeadlessController.h"
+#include "StudentWorld.h"
+#include "Replay.h"
+#include "AudioMixer.h"
+#include "AudioOutput.h"
+#include "SoundList.h"
+#include "Scheduler.h"
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
+using namespace std;
+
+  // Runs StudentWorld with no window at full speed:
+  //
+  //   GhostRacerHeadless [--level N] [--ticks N] [--seed N]
+  //                      [--worlds K] [--threads T] [--scaling]
+  //                      [--audio file.wav] [--tick-rate N]
+  //   GhostRacerHeadless --replay file
+  //
+  // The chosen level is played for the requested number of ticks.  When
+  // the racer dies or the level is finished the level is simply restarted,
+  // so the whole run measures the same workload.  Runs with the same seed
+  // play out identically; without --seed a random one is used and printed.
+  //
+  // With --worlds and/or --threads, K independent worlds (seeds seed,
+  // seed+1, ...) each play that many ticks, spread over T threads, and the
+  // aggregate ticks/sec is reported.  The total score depends only on the
+  // seeds, not on T, so it doubles as a check that worlds share no state.
+  // --scaling repeats the batch with 1, 2, 4, ... threads up to the number
+  // of hardware threads and reports the speedup over one thread.
+  //
+  // With --tick-rate (one world only), the world is ticked N times a
+  // second on a Scheduler, the way the game does, instead of as fast as
+  // possible, and how late the ticks ran is reported.
+  //
+  // With --audio (one world only), every sound the world plays is mixed
+  // by an AudioMixer into the given WAV file, a tick's worth of sound per
+  // tick (at the --tick-rate, or else the game's default rate), just as
+  // the game would have played it.
+  //
+  // With --replay, a session recorded by GhostRacer --record is played
+  // back as fast as possible, going from life to life and level to level
+  // the way the game does, and its final score and tick count are checked
+  // against the recording.  The exit status is 0 only if both match.
+
+static const int DEFAULT_LEVEL = 1;
+static const long DEFAULT_TICKS = 100000;
+static const int DEFAULT_MS_PER_TICK = 15;	// as in GameController
+static const char* const ASSET_DIRECTORY = "Assets";
+
+static void usage(const char* program)
+{
+	cout << "usage: " << program << " [--level N] [--ticks N] [--seed N]" << endl;
+	cout << "       " << program << "   [--worlds K] [--threads T] [--scaling]" << endl;
+	cout << "       " << program << "   [--audio file.wav] [--tick-rate N]" << endl;
+	cout << "       " << program << " --replay file" << endl;
+}
+
+static bool parsePositive(const char* text, long& value)
+{
+	char* end;
+	value = strtol(text, &end, 10);
+	return *text != '\0'  &&  *end == '\0'  &&  value > 0;
+}
+
+static bool parsePositive(const char* text, double& value)
+{
+	char* end;
+	value = strtod(text, &end);
+	return *text != '\0'  &&  *end == '\0'  &&  value > 0  &&  isfinite(value);
+}
+
+static int playReplay(string path)
+{
+	Replay replay;
+	if (!replay.load(path))
+	{
+		cout << "Cannot read replay file " << path << endl;
+		return 1;
+	}
+
+	HeadlessController controller;
+	StudentWorld world("");
+	world.setController(&controller);
+	world.setSeed(replay.getSeed());
+	for (int k = 1; k < replay.getLevel(); k++)
+		world.advanceToNextLevel();
+
+	const vector<ReplayKey>& keys = replay.getKeys();
+	size_t nextKey = 0;
+	bool gameOver = false;
+
+	auto start = chrono::steady_clock::now();
+	world.init();
+	while (world.getTicks() < replay.getTotalTicks()  &&  !gameOver)
+	{
+		  // The keys getKey() returned during the coming tick, if any
+		while (nextKey < keys.size()  &&  keys[nextKey].tick == world.getTicks() + 1)
+			controller.pressKey(keys[nextKey++].key);
+
+		int status = world.runTick();
+		if (status == GWSTATUS_CONTINUE_GAME  ||  world.getTicks() == replay.getTotalTicks())
+			continue;
+
+		  // Same transitions GameController makes between ticks
+		if (status == GWSTATUS_PLAYER_DIED  &&  world.isGameOver())
+			gameOver = true;
+		else
+		{
+			if (status == GWSTATUS_FINISHED_LEVEL)
+				world.advanceToNextLevel();
+			world.cleanUp();
+			if (world.init() == GWSTATUS_PLAYER_WON)
+				gameOver = true;
+		}
+	}
+	auto stop = chrono::steady_clock::now();
+
+	double seconds = chrono::duration<double>(stop - start).count();
+	cout << "Replayed " << world.getTicks() << " ticks in " << seconds << " s ("
+		 << (seconds > 0 ? world.getTicks() / seconds : 0) << " ticks/sec)" << endl;
+	cout << "Score: " << world.getScore() << " (recorded " << replay.getFinalScore() << ")"
+		 << "  Ticks: " << world.getTicks() << " (recorded " << replay.getTotalTicks() << ")" << endl;
+
+	bool matches = world.getScore() == replay.getFinalScore()  &&
+				   world.getTicks() == replay.getTotalTicks()  &&  nextKey == keys.size();
+	cout << (matches ? "Replay matches the recording" : "Replay DOES NOT match the recording") << endl;
+	return matches ? 0 : 1;
+}
+
+struct RunResult
+{
+	long			ticks = 0;
+	long			deaths = 0;
+	long			levelsFinished = 0;
+	long			sounds = 0;			// played
+	long			soundsRequested = 0;
+	long long		score = 0;
+	std::uint64_t	seed = 0;
+};
+
+  // Where --audio mixes a run's sounds to
+struct AudioRender
+{
+	AudioMixer			mixer;
+	int					clips[NUM_SOUND_IDS];	// sound ID to clip in mixer, or -1
+	AudioOutput*		output = nullptr;
+	double				msPerTick = DEFAULT_MS_PER_TICK;
+	vector<short>		block;
+};
+
+  // Mix the sound of one more tick
+static void renderTick(AudioRender& audio, long tick)
+{
+	long long framesBefore = static_cast<long long>((tick - 1) * double(AudioMixer::SAMPLE_RATE) * audio.msPerTick / 1000);
+	int frames = static_cast<int>(static_cast<long long>(tick * double(AudioMixer::SAMPLE_RATE) * audio.msPerTick / 1000) - framesBefore);
+	audio.block.resize(size_t(frames) * AudioMixer::CHANNELS);
+	audio.mixer.mix(audio.block.data(), frames);
+	audio.output->write(audio.block.data(), frames);
+}
+
+  // Play level for the given number of ticks, restarting the level
+  // whenever it ends.  A seed of 0 means pick a random one.  Ticks come as
+  // fast as possible, or on schedule if there is one.
+static RunResult playLevel(long level, long ticks, std::uint64_t seed, AudioRender* audio = nullptr,
+						   Scheduler* schedule = nullptr)
+{
+	HeadlessController controller;
+	StudentWorld world("");
+	world.setController(&controller);
+	if (audio != nullptr)
+		controller.setMixer(&audio->mixer, audio->clips);
+	if (seed != 0)
+		world.setSeed(seed);
+	for (int k = 1; k < level; k++)
+		world.advanceToNextLevel();
+
+	RunResult result;
+	world.init();
+	if (schedule != nullptr)
+		schedule->start();
+	while (result.ticks < ticks  &&  !controller.quitRequested())
+	{
+		if (schedule != nullptr)
+			schedule->sleepUntilNext();
+		result.ticks++;
+		int status = world.runTick();
+		if (audio != nullptr)
+			renderTick(*audio, result.ticks);
+		if (status == GWSTATUS_CONTINUE_GAME)
+			continue;
+
+		if (status == GWSTATUS_PLAYER_DIED)
+			result.deaths++;
+		else if (status == GWSTATUS_FINISHED_LEVEL)
+			result.levelsFinished++;
+		world.cleanUp();
+		world.init();
+	}
+	result.sounds = controller.soundsPlayed();
+	result.soundsRequested = world.getSoundsRequested();
+	result.score = world.getScore();
+	result.seed = world.getSeed();
+	return result;
+}
+
+  // Play K worlds on T threads; each thread takes the next unplayed world
+  // until there are none left.  Returns the wall-clock seconds taken.
+static double playWorlds(long level, long ticks, std::uint64_t seed, long numWorlds,
+						 long numThreads, RunResult& total)
+{
+	vector<RunResult> results(numWorlds);
+	atomic<long> nextWorld(0);
+	auto worker = [&]() {
+		for (long w = nextWorld++; w < numWorlds; w = nextWorld++)
+			results[w] = playLevel(level, ticks, seed + w);
+	};
+
+	auto start = chrono::steady_clock::now();
+	vector<thread> threads;
+	for (long t = 1; t < numThreads; t++)
+		threads.push_back(thread(worker));
+	worker();
+	for (size_t t = 0; t < threads.size(); t++)
+		threads[t].join();
+	auto stop = chrono::steady_clock::now();
+
+	total = RunResult();
+	total.seed = seed;
+	for (long w = 0; w < numWorlds; w++)
+	{
+		total.ticks += results[w].ticks;
+		total.deaths += results[w].deaths;
+		total.levelsFinished += results[w].levelsFinished;
+		total.sounds += results[w].sounds;
+		total.soundsRequested += results[w].soundsRequested;
+		total.score += results[w].score;
+	}
+	return chrono::duration<double>(stop - start).count();
+}
+
+static void reportBatch(long numWorlds, long numThreads, double seconds, const RunResult& total)
+{
+	cout << numWorlds << " worlds on " << numThreads << " threads: " << total.ticks << " ticks in "
+		 << seconds << " s (" << (seconds > 0 ? total.ticks / seconds : 0) << " ticks/sec)" << endl;
+	cout << "Deaths: " << total.deaths << "  Levels finished: " << total.levelsFinished
+		 << "  Sounds: " << total.sounds << " of " << total.soundsRequested << "  Total score: " << total.score << endl;
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc == 3  &&  strcmp(argv[1], "--replay") == 0)
+		return playReplay(argv[2]);
+
+	long level = DEFAULT_LEVEL;
+	long ticks = DEFAULT_TICKS;
+	long seed = 0;
+	long numWorlds = 0;
+	long numThreads = 0;
+	bool scaling = false;
+	string audioPath;
+	double tickRate = 0;
+
+	for (int k = 1; k < argc; k++)
+	{
+		bool ok = false;
+		if (strcmp(argv[k], "--level") == 0  &&  k+1 < argc)
+			ok = parsePositive(argv[++k], level);
+		else if (strcmp(argv[k], "--ticks") == 0  &&  k+1 < argc)
+			ok = parsePositive(argv[++k], ticks);
+		else if (strcmp(argv[k], "--seed") == 0  &&  k+1 < argc)
+			ok = parsePositive(argv[++k], seed);
+		else if (strcmp(argv[k], "--worlds") == 0  &&  k+1 < argc)
+			ok = parsePositive(argv[++k], numWorlds);
+		else if (strcmp(argv[k], "--threads") == 0  &&  k+1 < argc)
+			ok = parsePositive(argv[++k], numThreads);
+		else if (strcmp(argv[k], "--scaling") == 0)
+			ok = scaling = true;
+		else if (strcmp(argv[k], "--audio") == 0  &&  k+1 < argc)
+			ok = !(audioPath = argv[++k]).empty();
+		else if (strcmp(argv[k], "--tick-rate") == 0  &&  k+1 < argc)
+			ok = parsePositive(argv[++k], tickRate);
+		if (!ok)
+		{
+			usage(argv[0]);
+			return 1;
+		}
+	}
+
+	if ((!audioPath.empty()  ||  tickRate != 0)  &&  (numWorlds != 0  ||  numThreads != 0  ||  scaling))
+	{
+		usage(argv[0]);
+		return 1;
+	}
+
+	if (numWorlds == 0  &&  numThreads == 0  &&  !scaling)
+	{
+		AudioRender audio;
+		WAVFileOutput audioFile(audioPath, false);
+		Scheduler schedule(tickRate != 0 ? tickRate : 1000.0 / DEFAULT_MS_PER_TICK);
+		if (tickRate != 0)
+			audio.msPerTick = 1000 / tickRate;
+		int loaded = 0;
+		if (!audioPath.empty())
+		{
+			fill(audio.clips, audio.clips + NUM_SOUND_IDS, -1);
+			for (int k = 0; k < NUM_SOUNDS; k++)
+			{
+				int clip = audio.mixer.loadClip(string(ASSET_DIRECTORY) + "/" + SOUND_LIST[k].wavFileName);
+				audio.clips[SOUND_LIST[k].soundID] = clip;
+				if (clip >= 0)
+					loaded++;
+			}
+			if (!audioFile.open(AudioMixer::SAMPLE_RATE, AudioMixer::CHANNELS))
+			{
+				cout << "Cannot write audio file " << audioPath << endl;
+				return 1;
+			}
+			audio.output = &audioFile;
+		}
+
+		auto start = chrono::steady_clock::now();
+		RunResult result = playLevel(level, ticks, seed, audioPath.empty() ? nullptr : &audio,
+									 tickRate != 0 ? &schedule : nullptr);
+		auto stop = chrono::steady_clock::now();
+
+		double seconds = chrono::duration<double>(stop - start).count();
+		cout << "Level " << level << ": " << result.ticks << " ticks in " << seconds << " s ("
+			 << (seconds > 0 ? result.ticks / seconds : 0) << " ticks/sec)" << endl;
+		cout << "Deaths: " << result.deaths << "  Levels finished: " << result.levelsFinished
+			 << "  Sounds: " << result.sounds << " of " << result.soundsRequested << "  Score: " << result.score << endl;
+		cout << "Seed: " << result.seed << endl;
+		if (tickRate != 0)
+			cout << "Ticks woke " << schedule.getAverageJitter() << " ms late on average, "
+				 << schedule.getMaxJitter() << " ms at worst; " << schedule.getOverruns() << " overran" << endl;
+		if (!audioPath.empty())
+		{
+			audioFile.close();
+			cout << "Mixed the sounds (" << loaded << " of " << NUM_SOUNDS << " loaded) into "
+				 << audioPath << "; " << audio.mixer.droppedCommands() << " dropped" << endl;
+		}
+		return 0;
+	}
+
+	long hardwareThreads = max(1L, static_cast<long>(thread::hardware_concurrency()));
+	if (numThreads == 0)
+		numThreads = hardwareThreads;
+	if (numWorlds == 0)
+		numWorlds = numThreads;
+	  // Every world in the batch gets its own seed, so pick the base now
+	std::uint64_t baseSeed = (seed != 0 ? seed : RandomGenerator(chrono::steady_clock::now().time_since_epoch().count()).next() + 1);
+	cout << "Level " << level << ", " << ticks << " ticks per world, seeds from " << baseSeed << endl;
+
+	if (!scaling)
+	{
+		RunResult total;
+		double seconds = playWorlds(level, ticks, baseSeed, numWorlds, numThreads, total);
+		reportBatch(numWorlds, numThreads, seconds, total);
+		return 0;
+	}
+
+	double oneThreadRate = 0;
+	for (long t = 1; ; t = min(2 * t, hardwareThreads))
+	{
+		RunResult total;
+		double seconds = playWorlds(level, ticks, baseSeed, numWorlds, t, total);
+		reportBatch(numWorlds, t, seconds, total);
+		double rate = (seconds > 0 ? total.ticks / seconds : 0);
+		if (t == 1)
+			oneThreadRate = rate;
+		else if (oneThreadRate > 0)
+			cout << "Speedup over 1 thread: " << rate / oneThreadRate << "x ("
+				 << 100 * rate / oneThreadRate / t << "% of linear)" << endl;
+		if (t == hardwareThreads)
+			break;
+	}
+}
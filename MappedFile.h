@@ -0,0 +1,44 @@
+#ifndef MAPPEDFILE_H_
+#define MAPPEDFILE_H_
+
+#include <string>
+#include <cstddef>
+
+  // A whole file mapped read-only into memory (mmap, or MapViewOfFile on
+  // Windows).  Pages are read in by the OS as they are first touched, so
+  // opening costs a few system calls no matter how big the file is.
+
+class MappedFile
+{
+  public:
+	MappedFile();
+	~MappedFile();
+
+	  // Returns false if the file can't be opened or mapped (or is empty)
+	bool open(std::string path);
+	void close();
+
+	const unsigned char* data() const
+	{
+		return m_data;
+	}
+
+	std::size_t size() const
+	{
+		return m_size;
+	}
+
+  private:
+	const unsigned char*	m_data;
+	std::size_t				m_size;
+#ifdef _WIN32
+	void*					m_file;
+	void*					m_mapping;
+#endif
+
+	  // Prevent copying or assigning MappedFiles
+	MappedFile(const MappedFile&);
+	MappedFile& operator=(const MappedFile&);
+};
+
+#endif // MAPPEDFILE_H_
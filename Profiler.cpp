@@ -0,0 +1,172 @@
+#include "Profiler.h"
+
+#ifdef GR_PROFILE
+
+#include <string>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+using namespace std;
+
+const char* const PROFILE_PHASE_NAMES[NUM_PROFILE_PHASES] = {
+	"tick",
+	"racer",
+	"actors",
+	"sweep",
+	"add_human_peds",
+	"add_zombie_peds",
+	"add_zombie_cabs",
+	"add_oil_slicks",
+	"add_holy_water",
+	"add_lost_souls",
+	"hud",
+	"draw",
+};
+
+thread_local ProfileTimes Profiler::m_times;
+
+ProfileTimes Profiler::takeTimes()
+{
+	ProfileTimes times = m_times;
+	m_times = ProfileTimes();
+	return times;
+}
+
+bool ProfileLog::open(string path)
+{
+	m_file.open(path, ios::out|ios::trunc);
+	if (!m_file)
+		return false;
+	m_file << "tick";
+	for (int k = 0; k < NUM_PROFILE_PHASES; k++)
+		m_file << ',' << PROFILE_PHASE_NAMES[k] << "_ns";
+	m_file << '\n';
+	return static_cast<bool>(m_file);
+}
+
+void ProfileLog::writeRow(long tick, const ProfileTimes& times)
+{
+	if (!m_file.is_open())
+		return;
+	m_file << tick;
+	for (int k = 0; k < NUM_PROFILE_PHASES; k++)
+		m_file << ',' << times.ns[k];
+	m_file << '\n';
+}
+
+void ProfileLog::close()
+{
+	if (m_file.is_open())
+		m_file.close();
+}
+
+thread_local int TraceLog::m_thread = 0;
+
+TraceLog::TraceLog()
+ : m_on(false), m_firstEvent(true), m_numThreads(0)
+{
+}
+
+  // So a trace is finished even if the program exit()s
+TraceLog::~TraceLog()
+{
+	stop();
+}
+
+TraceLog& TraceLog::getInstance()
+{
+	static TraceLog instance;
+	return instance;
+}
+
+bool TraceLog::start(string path)
+{
+	lock_guard<mutex> lock(m_mutex);
+	if (m_on)
+		return false;
+	m_file.open(path, ios::out|ios::trunc);
+	if (!m_file)
+		return false;
+	m_file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	m_origin = Clock::now();
+	m_firstEvent = true;
+	m_events.reserve(FLUSH_EVENTS);
+	m_on = true;
+	return true;
+}
+
+void TraceLog::stop()
+{
+	lock_guard<mutex> lock(m_mutex);
+	if (!m_on)
+		return;
+	m_on = false;
+	writeEvents();
+	m_file << "\n]}\n";
+	m_file.close();
+}
+
+void TraceLog::addSpan(const char* name, const char* category, Clock::time_point start, Clock::time_point end)
+{
+	int t = thread();
+	lock_guard<mutex> lock(m_mutex);
+	if (!m_on)
+		return;
+	if (start < m_origin)	// begun before the trace was
+		start = m_origin;
+	Event event = { name, category, chrono::duration_cast<chrono::nanoseconds>(start - m_origin).count(),
+					chrono::duration_cast<chrono::nanoseconds>(end - start).count(), t };
+	m_events.push_back(event);
+	if (m_events.size() >= FLUSH_EVENTS)
+		writeEvents();
+}
+
+void TraceLog::nameThread(const char* name)
+{
+	int t = thread();
+	lock_guard<mutex> lock(m_mutex);
+	if (!m_on)
+		return;
+	separateEvent();
+	m_file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << t
+		   << ",\"args\":{\"name\":\"" << name << "\"}}";
+}
+
+  // Each thread is numbered the first time it traces anything
+int TraceLog::thread()
+{
+	if (m_thread == 0)
+	{
+		lock_guard<mutex> lock(m_mutex);
+		m_thread = ++m_numThreads;
+	}
+	return m_thread;
+}
+
+  // Called with m_mutex held.  Times are written in microseconds, the
+  // unit the format wants.
+void TraceLog::writeEvents()
+{
+	for (size_t k = 0; k < m_events.size(); k++)
+	{
+		const Event& e = m_events[k];
+		separateEvent();
+		m_file << "{\"name\":\"" << e.name << "\",\"cat\":\"" << e.category << "\",\"ph\":\"X\",\"ts\":"
+			   << e.startNs / 1000 << '.' << setfill('0') << setw(3) << e.startNs % 1000
+			   << ",\"dur\":" << e.durationNs / 1000 << '.' << setw(3) << e.durationNs % 1000 << setfill(' ')
+			   << ",\"pid\":1,\"tid\":" << e.thread << '}';
+	}
+	m_events.clear();
+}
+
+void TraceLog::separateEvent()
+{
+	if (!m_firstEvent)
+		m_file << ",\n";
+	m_firstEvent = false;
+}
+
+#endif // GR_PROFILE
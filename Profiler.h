@@ -0,0 +1,212 @@
+#ifndef PROFILER_H_
+#define PROFILER_H_
+
+  // Times the phases of a tick (and drawing) when built with GR_PROFILE
+  // defined (e.g., -DGR_PROFILE, or in Visual Studio, GhostRacer's Profile
+  // configuration, which is Release plus GR_PROFILE).  Without it,
+  // PROFILE_SCOPE and everything else here compiles to nothing.  A
+  // profiling build of the game shows the phase times when F1 is pressed,
+  // and takes --profile-csv file and --trace file.
+  //
+  // PROFILE_SCOPE(phase) at the start of a block adds the time until the
+  // end of the block to that phase.  Times add up per thread, so each
+  // world's thread keeps its own; whoever drives a world calls
+  // Profiler::takeTimes() after each tick to collect the tick's times.
+  //
+  // While Trace() is started, every PROFILE_SCOPE, and every
+  // TRACE_SCOPE(name) (which only traces), is also written to a Chrome
+  // trace-event JSON file, one span per block, on a track per thread, to
+  // be opened in chrome://tracing or ui.perfetto.dev.  A span that isn't a
+  // block is added with TRACE_SPAN(name, category, start, end), and
+  // TRACE_THREAD_NAME(name) labels the calling thread's track.
+
+enum ProfilePhase
+{
+	PROFILE_TICK,				// all of GameWorld::runTick()
+	PROFILE_RACER,				// StudentWorld::move() phases...
+	PROFILE_ACTORS,
+	PROFILE_SWEEP,
+	PROFILE_ADD_HUMAN_PEDS,
+	PROFILE_ADD_ZOMBIE_PEDS,
+	PROFILE_ADD_ZOMBIE_CABS,
+	PROFILE_ADD_OIL_SLICKS,
+	PROFILE_ADD_HOLY_WATER,
+	PROFILE_ADD_LOST_SOULS,
+	PROFILE_HUD,
+	PROFILE_DRAW,				// GameController::displayGamePlay()
+	NUM_PROFILE_PHASES
+};
+
+#ifdef GR_PROFILE
+
+#include <chrono>
+#include <string>
+#include <fstream>
+#include <vector>
+#include <mutex>
+#include <atomic>
+
+extern const char* const PROFILE_PHASE_NAMES[NUM_PROFILE_PHASES];
+
+struct ProfileTimes
+{
+	long long	ns[NUM_PROFILE_PHASES];
+};
+
+class Profiler
+{
+  public:
+	static void add(ProfilePhase phase, long long ns)
+	{
+		m_times.ns[phase] += ns;
+	}
+
+	  // This thread's times since the last call
+	static ProfileTimes takeTimes();
+
+  private:
+	static thread_local ProfileTimes m_times;
+};
+
+class TraceLog
+{
+  public:
+	using Clock = std::chrono::steady_clock;
+
+	  // Returns false if the file can't be written
+	bool start(std::string path);
+	void stop();
+
+	bool isOn() const
+	{
+		return m_on.load(std::memory_order_relaxed);
+	}
+
+	  // name and category must be string literals (or otherwise outlive
+	  // the trace), since only the pointers are kept until written
+	void addSpan(const char* name, const char* category, Clock::time_point start, Clock::time_point end);
+
+	  // Labels the calling thread's track
+	void nameThread(const char* name);
+
+	static TraceLog& getInstance();
+
+  private:
+	static const std::size_t FLUSH_EVENTS = 4096;
+
+	struct Event
+	{
+		const char*	name;
+		const char*	category;
+		long long	startNs;		// since m_origin
+		long long	durationNs;
+		int			thread;
+	};
+
+	std::mutex			m_mutex;		// guards everything but m_on
+	std::atomic<bool>	m_on;
+	std::ofstream		m_file;
+	std::vector<Event>	m_events;		// not yet written
+	Clock::time_point	m_origin;
+	bool				m_firstEvent;
+	int					m_numThreads;
+
+	static thread_local int m_thread;	// 0 until the thread's first event
+
+	TraceLog();
+	~TraceLog();
+	int thread();
+	void writeEvents();
+	void separateEvent();
+
+	TraceLog(const TraceLog&);
+	TraceLog& operator=(const TraceLog&);
+};
+
+inline TraceLog& Trace()
+{
+	return TraceLog::getInstance();
+}
+
+class ProfileScope
+{
+  public:
+	explicit ProfileScope(ProfilePhase phase)
+	 : m_phase(phase), m_start(std::chrono::steady_clock::now())
+	{
+	}
+
+	~ProfileScope()
+	{
+		std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+		Profiler::add(m_phase, std::chrono::duration_cast<std::chrono::nanoseconds>(end - m_start).count());
+		if (Trace().isOn())
+			Trace().addSpan(PROFILE_PHASE_NAMES[m_phase], "phase", m_start, end);
+	}
+
+  private:
+	ProfilePhase m_phase;
+	std::chrono::steady_clock::time_point m_start;
+
+	ProfileScope(const ProfileScope&);
+	ProfileScope& operator=(const ProfileScope&);
+};
+
+class TraceScope
+{
+  public:
+	explicit TraceScope(const char* name)
+	 : m_name(name), m_start(std::chrono::steady_clock::now())
+	{
+	}
+
+	~TraceScope()
+	{
+		if (Trace().isOn())
+			Trace().addSpan(m_name, "game", m_start, std::chrono::steady_clock::now());
+	}
+
+  private:
+	const char* m_name;
+	std::chrono::steady_clock::time_point m_start;
+
+	TraceScope(const TraceScope&);
+	TraceScope& operator=(const TraceScope&);
+};
+
+  // Writes a CSV row per tick: the tick number, then the nanoseconds spent
+  // in each phase, with a header row naming them
+class ProfileLog
+{
+  public:
+	bool open(std::string path);
+	void writeRow(long tick, const ProfileTimes& times);
+	void close();
+
+	bool isOpen() const
+	{
+		return m_file.is_open();
+	}
+
+  private:
+	std::ofstream m_file;
+};
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(phase) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(phase)
+#define TRACE_SCOPE(name) TraceScope PROFILE_CONCAT(traceScope, __LINE__)(name)
+#define TRACE_SPAN(name, category, start, end) \
+	do { if (Trace().isOn()) Trace().addSpan(name, category, start, end); } while (false)
+#define TRACE_THREAD_NAME(name) Trace().nameThread(name)
+
+#else
+
+#define PROFILE_SCOPE(phase)
+#define TRACE_SCOPE(name)
+#define TRACE_SPAN(name, category, start, end)
+#define TRACE_THREAD_NAME(name)
+
+#endif // GR_PROFILE
+
+#endif // PROFILER_H_
@@ -0,0 +1,83 @@
+#ifndef RANDOMGENERATOR_H_
+#define RANDOMGENERATOR_H_
+
+#include <cstdint>
+#include <utility>
+
+  // A small, fast PCG32 generator (O'Neill, pcg-random.org: XSH-RR output on
+  // a 64-bit LCG).  Two generators seeded alike produce the same sequence on
+  // every platform, so a run can be reproduced exactly from its seed, which
+  // std::default_random_engine and std::uniform_int_distribution don't
+  // promise.
+
+class RandomGenerator
+{
+  public:
+	explicit RandomGenerator(std::uint64_t seed = 0)
+	{
+		setSeed(seed);
+	}
+
+	void setSeed(std::uint64_t seed)
+	{
+		m_seed = seed;
+		m_state = 0;
+		next();
+		m_state += seed;
+		next();
+	}
+
+	std::uint64_t getSeed() const
+	{
+		return m_seed;
+	}
+
+	  // Uniformly distributed 32-bit value
+	std::uint32_t next()
+	{
+		std::uint64_t old = m_state;
+		m_state = old * MULTIPLIER + INCREMENT;
+		std::uint32_t xorShifted = static_cast<std::uint32_t>(((old >> 18) ^ old) >> 27);
+		std::uint32_t rot = static_cast<std::uint32_t>(old >> 59);
+		return (xorShifted >> rot) | (xorShifted << ((32 - rot) & 31));
+	}
+
+	  // Uniformly distributed value from 0 to range-1 (range must be > 0).
+	  // Uses Lemire's multiply-and-shift, which only needs a division in
+	  // the rare case where the low word lands in the biased region.
+	std::uint32_t nextBelow(std::uint32_t range)
+	{
+		std::uint64_t m = std::uint64_t(next()) * range;
+		std::uint32_t low = static_cast<std::uint32_t>(m);
+		if (low < range)
+		{
+			std::uint32_t threshold = (0u - range) % range;
+			while (low < threshold)
+			{
+				m = std::uint64_t(next()) * range;
+				low = static_cast<std::uint32_t>(m);
+			}
+		}
+		return static_cast<std::uint32_t>(m >> 32);
+	}
+
+	  // Uniformly distributed int from min to max, inclusive
+	int randInt(int min, int max)
+	{
+		if (max < min)
+			std::swap(max, min);
+		std::uint32_t span = static_cast<std::uint32_t>(std::int64_t(max) - min) + 1;
+		if (span == 0)	// the full range of int
+			return static_cast<int>(next());
+		return static_cast<int>(std::int64_t(min) + nextBelow(span));
+	}
+
+  private:
+	static const std::uint64_t MULTIPLIER = 6364136223846793005ULL;
+	static const std::uint64_t INCREMENT = 1442695040888963407ULL;
+
+	std::uint64_t	m_state;
+	std::uint64_t	m_seed;
+};
+
+#endif // RANDOMGENERATOR_H_
@@ -0,0 +1,122 @@
+#include "Replay.h"
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <cstdint>
+using namespace std;
+
+static const char MAGIC[4] = { 'G', 'R', 'R', 'P' };
+static const unsigned char VERSION = 2;
+
+static void putVarint(vector<unsigned char>& out, uint64_t value)
+{
+	while (value >= 0x80)
+	{
+		out.push_back(static_cast<unsigned char>(value | 0x80));
+		value >>= 7;
+	}
+	out.push_back(static_cast<unsigned char>(value));
+}
+
+  // Keys and scores can be negative in principle; zigzag keeps small
+  // magnitudes small either way
+static void putSigned(vector<unsigned char>& out, int64_t value)
+{
+	putVarint(out, (uint64_t(value) << 1) ^ uint64_t(value >> 63));
+}
+
+static bool getVarint(const vector<unsigned char>& in, size_t& pos, uint64_t& value)
+{
+	value = 0;
+	for (int shift = 0; shift < 64; shift += 7)
+	{
+		if (pos == in.size())
+			return false;
+		unsigned char byte = in[pos++];
+		value |= uint64_t(byte & 0x7f) << shift;
+		if ((byte & 0x80) == 0)
+			return true;
+	}
+	return false;
+}
+
+static bool getSigned(const vector<unsigned char>& in, size_t& pos, int64_t& value)
+{
+	uint64_t raw;
+	if (!getVarint(in, pos, raw))
+		return false;
+	value = int64_t(raw >> 1) ^ -int64_t(raw & 1);
+	return true;
+}
+
+bool Replay::save(string path) const
+{
+	vector<unsigned char> out(MAGIC, MAGIC + sizeof(MAGIC));
+	out.push_back(VERSION);
+	putVarint(out, m_seed);
+	putSigned(out, m_level);
+	putVarint(out, m_keys.size());
+	long lastTick = 0;
+	for (size_t k = 0; k < m_keys.size(); k++)
+	{
+		putVarint(out, m_keys[k].tick - lastTick);
+		putSigned(out, m_keys[k].key);
+		lastTick = m_keys[k].tick;
+	}
+	putVarint(out, m_totalTicks);
+	putSigned(out, m_finalScore);
+
+	ofstream ofs(path, ios::binary);
+	if (!ofs)
+		return false;
+	ofs.write(reinterpret_cast<const char*>(out.data()), out.size());
+	return static_cast<bool>(ofs);
+}
+
+bool Replay::load(string path)
+{
+	start(0, 1);
+
+	ifstream ifs(path, ios::binary);
+	if (!ifs)
+		return false;
+	vector<unsigned char> in((istreambuf_iterator<char>(ifs)), istreambuf_iterator<char>());
+
+	if (in.size() < sizeof(MAGIC) + 1  ||  !equal(MAGIC, MAGIC + sizeof(MAGIC), in.begin())  ||
+		in[sizeof(MAGIC)] != VERSION)
+		return false;
+
+	size_t pos = sizeof(MAGIC) + 1;
+	uint64_t seed;
+	int64_t level;
+	if (!getVarint(in, pos, seed)  ||  !getSigned(in, pos, level))
+		return false;
+	start(seed, static_cast<int>(level));
+
+	uint64_t numKeys;
+	bool ok = getVarint(in, pos, numKeys);
+	long tick = 0;
+	for (uint64_t k = 0; ok  &&  k < numKeys; k++)
+	{
+		uint64_t delta;
+		int64_t key;
+		ok = getVarint(in, pos, delta)  &&  getSigned(in, pos, key);
+		if (ok)
+		{
+			tick += static_cast<long>(delta);
+			addKey(tick, static_cast<int>(key));
+		}
+	}
+
+	uint64_t totalTicks;
+	int64_t finalScore;
+	if (!ok  ||  !getVarint(in, pos, totalTicks)  ||  !getSigned(in, pos, finalScore))
+	{
+		start(0, 1);
+		return false;
+	}
+	finish(static_cast<long>(totalTicks), static_cast<int>(finalScore));
+	return true;
+}
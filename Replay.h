@@ -0,0 +1,74 @@
+#ifndef REPLAY_H_
+#define REPLAY_H_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+  // A recorded session: the world's random seed and starting level, every
+  // key the world took from GameWorld::getKey along with the tick it was
+  // taken on, and how the session ended.  Since a world is deterministic
+  // given its seed and its keys, feeding the keys back in at the same
+  // ticks plays the session out exactly as it happened.
+  //
+  // On disk a replay is the magic "GRRP", a version byte, and then
+  // variable-length (LEB128) integers: seed, level, the number of keys, a
+  // (tick delta, key) pair per key, then the total number of ticks and
+  // the final score.  A delta may be 0, since several keys can be taken
+  // on one tick.  A typical session takes a few bytes per key pressed.
+
+struct ReplayKey
+{
+	long	tick;	// 1 for the first call of move() in the session
+	int		key;
+};
+
+class Replay
+{
+  public:
+	Replay()
+	 : m_seed(0), m_level(1), m_totalTicks(0), m_finalScore(0)
+	{
+	}
+
+	void start(std::uint64_t seed, int level)
+	{
+		m_seed = seed;
+		m_level = level;
+		m_keys.clear();
+		m_totalTicks = 0;
+		m_finalScore = 0;
+	}
+
+	void addKey(long tick, int key)
+	{
+		ReplayKey k = { tick, key };
+		m_keys.push_back(k);
+	}
+
+	void finish(long totalTicks, int finalScore)
+	{
+		m_totalTicks = totalTicks;
+		m_finalScore = finalScore;
+	}
+
+	std::uint64_t getSeed() const	{ return m_seed; }
+	int getLevel() const			{ return m_level; }
+	const std::vector<ReplayKey>& getKeys() const { return m_keys; }
+	long getTotalTicks() const		{ return m_totalTicks; }
+	int getFinalScore() const		{ return m_finalScore; }
+
+	  // Both return false if the file can't be opened; load() also returns
+	  // false (leaving this replay empty) if the file isn't a valid replay.
+	bool save(std::string path) const;
+	bool load(std::string path);
+
+  private:
+	std::uint64_t	m_seed;
+	int				m_level;
+	std::vector<ReplayKey> m_keys;
+	long			m_totalTicks;
+	int				m_finalScore;
+};
+
+#endif // REPLAY_H_
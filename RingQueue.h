@@ -0,0 +1,84 @@
+#ifndef RINGQUEUE_H_
+#define RINGQUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+  // A fixed-size FIFO of Ts that any number of threads can push() onto and
+  // one thread pop()s from, without locks.  Each slot carries a sequence
+  // number saying whose turn it is: a pusher claims the next slot with a
+  // compare-and-swap, fills it, and then hands it to the popper by bumping
+  // the sequence; the popper hands it back the same way.  A push onto a
+  // full queue fails rather than waits.  CAPACITY must be a power of two.
+
+template<typename T, std::size_t CAPACITY>
+class RingQueue
+{
+	static_assert(CAPACITY >= 2  &&  (CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+  public:
+	RingQueue()
+	 : m_pushPosition(0), m_popPosition(0)
+	{
+		for (std::size_t k = 0; k < CAPACITY; k++)
+			m_slots[k].sequence.store(k, std::memory_order_relaxed);
+	}
+
+	  // Returns false if the queue is full
+	bool push(const T& value)
+	{
+		std::size_t position = m_pushPosition.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			Slot& slot = m_slots[position & MASK];
+			std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+			std::intptr_t lag = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+			if (lag == 0)
+			{
+				if (m_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					slot.value = value;
+					slot.sequence.store(position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (lag < 0)
+				return false;	// the popper hasn't emptied this slot yet
+			else
+				position = m_pushPosition.load(std::memory_order_relaxed);
+		}
+	}
+
+	  // Only one thread may pop.  Returns false if the queue is empty.
+	bool pop(T& value)
+	{
+		std::size_t position = m_popPosition.load(std::memory_order_relaxed);
+		Slot& slot = m_slots[position & MASK];
+		if (slot.sequence.load(std::memory_order_acquire) != position + 1)
+			return false;
+		value = slot.value;
+		slot.sequence.store(position + CAPACITY, std::memory_order_release);
+		m_popPosition.store(position + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+  private:
+	static const std::size_t MASK = CAPACITY - 1;
+
+	struct Slot
+	{
+		std::atomic<std::size_t>	sequence;
+		T							value;
+	};
+
+	Slot m_slots[CAPACITY];
+	alignas(64) std::atomic<std::size_t> m_pushPosition;	// kept on separate cache lines,
+	alignas(64) std::atomic<std::size_t> m_popPosition;		// since different threads hammer them
+
+	  // Prevent copying or assigning RingQueues
+	RingQueue(const RingQueue&);
+	RingQueue& operator=(const RingQueue&);
+};
+
+#endif // RINGQUEUE_H_
@@ -0,0 +1,64 @@
+#include "Scheduler.h"
+#include <chrono>
+#include <thread>
+#include <cmath>
+using namespace std;
+
+  // Further behind than this, and the schedule starts over from now
+static const int MAX_PERIODS_BEHIND = 4;
+
+Scheduler::Scheduler(double rate)
+ : m_wakeups(0), m_overruns(0), m_totalJitter(0), m_maxJitter(0)
+{
+	setRate(rate);
+	start();
+}
+
+void Scheduler::setRate(double rate)
+{
+	m_rate = rate;
+	m_period = chrono::duration_cast<Clock::duration>(chrono::duration<double>(1 / rate));
+}
+
+void Scheduler::start()
+{
+	m_next = Clock::now() + m_period;
+}
+
+void Scheduler::restartNow()
+{
+	m_next = Clock::now();
+}
+
+void Scheduler::sleepUntilNext()
+{
+	waitTime();
+	this_thread::sleep_until(m_next);
+	wokeUp();
+}
+
+  // How long until the next deadline; none if it has already passed, in
+  // which case the deadline is only moved up to now if we're too far
+  // behind to catch up
+Scheduler::Clock::duration Scheduler::waitTime()
+{
+	Clock::time_point now = Clock::now();
+	if (m_next >= now)
+		return m_next - now;
+
+	m_overruns++;
+	if (now - m_next > MAX_PERIODS_BEHIND * m_period)
+		m_next = now;
+	return Clock::duration::zero();
+}
+
+void Scheduler::wokeUp()
+{
+	Clock::time_point now = Clock::now();
+	double jitter = fabs(chrono::duration<double, milli>(now - m_next).count());
+	m_wakeups++;
+	m_totalJitter += jitter;
+	if (jitter > m_maxJitter)
+		m_maxJitter = jitter;
+	m_next += m_period;
+}
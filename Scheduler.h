@@ -0,0 +1,81 @@
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+#include <chrono>
+
+  // Wakes a thread rate times a second.  Each deadline is a period after
+  // the one before, not after when the thread actually woke, so lateness
+  // in one wakeup doesn't push back all the ones after it.  If the work
+  // between wakeups runs so long that a deadline has already passed,
+  // that's counted as an overrun, and the thread doesn't wait at all until
+  // it has caught up.  Only if it is more than a few periods behind
+  // (e.g., it was stopped in a debugger) does the schedule start over
+  // from now rather than rush through all it missed.  How late each
+  // wakeup came after its deadline is recorded as jitter.
+  //
+  // A thread that can sleep calls sleepUntilNext().  One that has to do
+  // its waiting some other way (e.g., the GLUT thread, by timer) waits
+  // waitTime() and then calls wokeUp().
+
+class Scheduler
+{
+  public:
+	using Clock = std::chrono::steady_clock;
+
+	explicit Scheduler(double rate);
+
+	  // rate is wakeups per second
+	void setRate(double rate);
+
+	double getRate() const
+	{
+		return m_rate;
+	}
+
+	Clock::duration getPeriod() const
+	{
+		return m_period;
+	}
+
+	  // The first deadline is one period from now
+	void start();
+
+	  // The next deadline is now (e.g., after waiting on something else)
+	void restartNow();
+
+	void sleepUntilNext();
+	Clock::duration waitTime();
+	void wokeUp();
+
+	long getWakeups() const
+	{
+		return m_wakeups;
+	}
+
+	long getOverruns() const
+	{
+		return m_overruns;
+	}
+
+	  // In milliseconds
+	double getAverageJitter() const
+	{
+		return m_wakeups == 0 ? 0 : m_totalJitter / m_wakeups;
+	}
+
+	double getMaxJitter() const
+	{
+		return m_maxJitter;
+	}
+
+  private:
+	double				m_rate;
+	Clock::duration		m_period;
+	Clock::time_point	m_next;
+	long				m_wakeups;
+	long				m_overruns;
+	double				m_totalJitter;	// ms
+	double				m_maxJitter;	// ms
+};
+
+#endif // SCHEDULER_H_
@@ -1,104 +1,79 @@
 #ifndef SOUNDFX_H_
 #define SOUNDFX_H_
 
+#include "AudioMixer.h"
+#include "AudioOutput.h"
 #include <string>
+#include <map>
 #include <memory>
-
-#if defined(_MSC_VER)
-
-#include "irrKlang/irrKlang.h"
-#pragma comment(lib, "irrKlang.lib")
 #include <iostream>
 
+  // Plays sound clips through an AudioMixer on the platform's sound device.
+  // Where there is none (or it won't open), the mixer is never started and
+  // the game runs silent, without a thread mixing blocks nobody hears.
+  // Clips are loaded with loadClip() before anything is played, and then
+  // played by the handle it returned; playClip() and abortClip() never
+  // wait or allocate, and may be called from any thread.
+
 class SoundFXController
 {
   public:
 
-	void playClip(std::string soundFile)
+	  // Returns the handle to play the clip by, or -1 if it can't be
+	  // loaded.  Call before playing anything, from one thread.
+	int loadClip(std::string soundFile)
+	{
+		auto p = m_clips.find(soundFile);
+		if (p != m_clips.end())
+			return p->second;
+		int clip = m_mixer.loadClip(soundFile);
+		if (clip >= 0)
+			m_clips[soundFile] = clip;
+		return clip;
+	}
+
+	  // A handle of -1 plays nothing
+	void playClip(int clip)
 	{
-		if (m_engine != nullptr)
-			m_engine->play2D(soundFile.c_str(), false);
+		if (!m_silent)
+			m_mixer.play(clip);
 	}
 
 	void abortClip()
 	{
-		if (m_engine != nullptr)
-			m_engine->stopAllSounds();
+		if (!m_silent)
+			m_mixer.stopAll();
 	}
 
 	static SoundFXController& getInstance();
 
   private:
-	irrklang::ISoundEngine* m_engine;
+	AudioMixer						m_mixer;
+	std::unique_ptr<AudioOutput>	m_output;
+	std::map<std::string, int>		m_clips;	// file name to handle, so each is loaded once
+	bool							m_silent;	// set once, before any clip is played
 
 	SoundFXController()
+	 : m_output(createDeviceOutput()), m_silent(false)
 	{
-		m_engine = irrklang::createIrrKlangDevice();
-		if (m_engine == nullptr)
-			std::cout << "Cannot create sound engine!  Game will be silent."
-					  << std::endl;
+		if (m_output == nullptr  ||  !m_mixer.start(m_output.get()))
+		{
+			if (m_output != nullptr)
+				std::cout << "Cannot open the sound device!  Game will be silent." << std::endl;
+			m_output.reset();
+			m_silent = true;
+		}
 	}
 
 	~SoundFXController()
 	{
-		if (m_engine != nullptr)
-			m_engine->drop();
+		m_mixer.stop();
 	}
 
 	SoundFXController(const SoundFXController&);
 	SoundFXController& operator=(const SoundFXController&);
 };
 
-#elif defined(__APPLE__)
-
-#include <memory>
-#include <spawn.h>
-#include <csignal>
-#include <cstring>
-
-class SoundFXController
-{
-  public:
-    SoundFXController()
-     : pidValid(false)
-    {}
-
-    void playClip(std::string soundFile)
-    {
-        char cmd[] = "/usr/bin/afplay";
-        std::unique_ptr<char[]> fileName(new char[soundFile.size()+1]);
-        std::strcpy(fileName.get(), soundFile.c_str());
-        char* argv[] = { cmd, fileName.get(), nullptr };
-        abortClip();  // stop anything currently playing
-        pidValid = (posix_spawn(&pid, argv[0], nullptr, nullptr, argv, nullptr) == 0);
-    }
-    
-    void abortClip()
-    {
-        if (pidValid)
-            kill(pid, SIGINT);
-        pidValid = false;
-    }
-    
-    static SoundFXController& getInstance();
-
-  private:
-    pid_t pid;
-    bool pidValid;
-};
-
-#else  // forget about sound
-
-class SoundFXController
-{
-  public:
-    void playClip(std::string) {}
-    void abortClip() {}
-    static SoundFXController& getInstance();
-};
-
-#endif
-
   // Meyers singleton pattern
 inline SoundFXController& SoundFXController::getInstance()
 {
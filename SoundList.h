@@ -0,0 +1,34 @@
+#ifndef SOUNDLIST_H_
+#define SOUNDLIST_H_
+
+#include "GameConstants.h"
+
+  // The WAV file played for each sound the world can ask for.  Shared by
+  // the game and by GhostRacerHeadless, which can mix a run's sounds into
+  // a file.
+
+struct SoundInfo
+{
+	int			soundID;
+	const char*	wavFileName;
+};
+
+const SoundInfo SOUND_LIST[] = {
+	{ SOUND_PED_HURT			, "hurt.wav" },
+	{ SOUND_VEHICLE_HURT        , "hurt.wav" },
+	{ SOUND_VEHICLE_CRASH        , "crash.wav" },
+	{ SOUND_PLAYER_DIE             , "die.wav" },
+	{ SOUND_OIL_SLICK             , "skid.wav" },
+	{ SOUND_FINISHED_LEVEL		   , "finished.wav" },
+	{ SOUND_PLAYER_SPRAY		   , "squirt.wav" },
+	{ SOUND_VEHICLE_DIE			   , "zombiedie.wav" },
+	{ SOUND_PED_DIE					, "zombiedie.wav" },
+	{ SOUND_THEME					, "theme.wav" },
+	{ SOUND_GOT_GOODIE		    , "goodie.wav" },
+	{ SOUND_GOT_SOUL		    , "bell.wav" },
+	{ SOUND_ZOMBIE_ATTACK		, "attack.wav" }
+};
+
+const int NUM_SOUNDS = sizeof(SOUND_LIST) / sizeof(SOUND_LIST[0]);
+
+#endif // SOUNDLIST_H_
@@ -0,0 +1,39 @@
+#ifndef SPRITELIST_H_
+#define SPRITELIST_H_
+
+#include "GameConstants.h"
+
+  // Every sprite frame the game draws, and the TGA file it comes from.
+  // Shared by the game and by AssetPacker, so a bundle holds exactly the
+  // sprites the game asks for.
+
+struct SpriteInfo
+{
+	unsigned int imageID;
+	unsigned int frameNum;
+	const char*	 tgaFileName;
+};
+
+const SpriteInfo SPRITE_LIST[] = {
+	{ IID_GHOST_RACER	 , 0, "redcar.tga" },
+	{ IID_WHITE_BORDER_LINE	 , 0, "white-lane.tga" },
+	{ IID_YELLOW_BORDER_LINE , 0, "yellow-lane.tga" },
+	{ IID_OIL_SLICK	, 0, "oil.tga" },
+	{ IID_HUMAN_PED	, 0, "dude_1.tga" },
+	{ IID_HUMAN_PED	, 1, "dude_2.tga" },
+	{ IID_HUMAN_PED	, 2, "dude_3.tga" },
+	{ IID_ZOMBIE_PED	, 0, "zombie_1.tga" },
+	{ IID_ZOMBIE_PED	, 1, "zombie_2.tga" },
+	{ IID_ZOMBIE_PED	, 2, "zombie_3.tga" },
+	{ IID_ZOMBIE_CAB		   , 0, "yellow.tga" },
+	{ IID_HOLY_WATER_PROJECTILE	   , 0, "water1.tga" },
+	{ IID_HOLY_WATER_PROJECTILE	   , 1, "water2.tga" },
+	{ IID_HOLY_WATER_PROJECTILE	   , 2, "water3.tga" },
+	{ IID_HEAL_GOODIE  , 0, "health.tga"},
+	{ IID_HOLY_WATER_GOODIE  , 0, "holy_water.tga"},
+	{ IID_SOUL_GOODIE  , 0, "soul.tga"},
+};
+
+const int NUM_SPRITES = sizeof(SPRITE_LIST) / sizeof(SPRITE_LIST[0]);
+
+#endif // SPRITELIST_H_
@@ -12,18 +12,22 @@
 #endif
 
 #include "GameConstants.h"
+#include "TextureAtlas.h"
+#include "AtlasBuilder.h"
+#include "AssetBundle.h"
+#include "AngleTable.h"
 #include <iostream>
-#include <fstream>
 #include <string>
 #include <map>
-#include <memory>
+#include <vector>
+#include <algorithm>
 
 class SpriteManager
 {
 public:
 
 	SpriteManager()
-	 : m_mipMapped(true)
+	 : m_mipMapped(true), m_atlasTexture(0)
 	{
 	}
 
@@ -32,96 +36,41 @@ public:
 		m_mipMapped = status;
 	}
 
-	bool loadSprite(std::string filename_tga, int imageID, int frameNum)
+	  // Takes every sprite, and the atlas with its mipmaps, from a
+	  // PackedAtlas built from the TGA files
+	void loadAtlas(const PackedAtlas& atlas)
 	{
-		  // Load Texture Data From TGA File
+		addSprites(atlas.sprites.data(), static_cast<int>(atlas.sprites.size()), atlas.height);
 
-		unsigned int spriteID = getSpriteID(imageID, frameNum);
-		if (INVALID_SPRITE_ID == spriteID)
-			return false;
-
-		m_frameCountPerSprite[imageID]++;	// keep track of how many frames per sprite we loaded
-
-		std::string line;
-		std::string contents = "";
-		std::ifstream tgaFile(filename_tga, std::ios::in|std::ios::binary);
-
-		if (!tgaFile)
-			return false;
-
-		char type[3];
-		char info[6];
-        
-          // Read file header info
-        tgaFile.read(type, 3);
-        tgaFile.seekg(12);
-        tgaFile.read(info, 6);
-        unsigned int textureWidth = static_cast<unsigned char>(info[0]) + static_cast<unsigned char>(info[1]) * 256;
-        unsigned int textureHeight = static_cast<unsigned char>(info[2]) + static_cast<unsigned char>(info[3]) * 256;
-        unsigned char byteCount = static_cast<unsigned char>(info[4]) / 8;
-        long imageSize = textureWidth * textureHeight * byteCount;
-        std::unique_ptr<char[]> imageData(new char[imageSize]);
-        tgaFile.seekg(18);
-          // Read image data
-		tgaFile.read(imageData.get(), imageSize);
-		if (!tgaFile)
-			return false;
-
-		  //image type either 2 (color) or 3 (greyscale)
-		if (type[1] != 0 || (type[2] != 2 && type[2] != 3))
-			return false;
-
-		if (byteCount != 3 && byteCount != 4)
-			return false;
-
-		  // Transfer Texture To OpenGL
-
-		glEnable(GL_DEPTH_TEST);
-
-		  // allocate a texture handle
-		GLuint glTextureID;
-		glGenTextures(1, &glTextureID);
-
-		  // bind our new texture
-		glBindTexture(GL_TEXTURE_2D, glTextureID);
-
-		glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-
-		if (m_mipMapped)
+		GLuint glTextureID = makeTexture();
+		int numLevels = (m_mipMapped ? static_cast<int>(atlas.levels.size()) : 1);
+		for (int level = 0, width = atlas.width, height = atlas.height; level < numLevels; level++)
 		{
-			  // when texture area is small, bilinear filter the closest mipmap
-			glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-			  // when texture area is large, bilinear filter the first mipmap
-			glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-		}
-		else
-		{
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA, width, height, 0, GL_BGRA, GL_UNSIGNED_BYTE, atlas.levels[level].data());
+			width = std::max(width / 2, 1);
+			height = std::max(height / 2, 1);
 		}
 
-		  // Have the texture wrap both vertically and horizontally.
-		glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, static_cast<GLfloat>(GL_REPEAT));
-		glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, static_cast<GLfloat>(GL_REPEAT));
+		m_atlasTexture = glTextureID;
+	}
 
-		if (m_mipMapped)
-		{
-			  // build our texture mipmaps
-			  // byteCount of 3 means that BGR data is being supplied. byteCount of 4 means that BGRA data is being supplied.
-            makeMipmaps(byteCount, textureWidth, textureHeight, imageData.get());
-        }
-		else
+	  // Or takes them from a bundle that AssetPacker built ahead of time
+	void loadBundle(const AssetBundle& bundle)
+	{
+		addSprites(&bundle.getSprite(0), bundle.getNumSprites(), bundle.getHeight());
+
+		GLuint glTextureID = makeTexture();
+
+		  // Each level goes straight from the mapped file to OpenGL
+		int numLevels = (m_mipMapped ? bundle.getNumLevels() : 1);
+		for (int level = 0; level < numLevels; level++)
 		{
-			  // byteCount of 3 means that BGR data is being supplied. byteCount of 4 means that BGRA data is being supplied.
-			if (3 == byteCount)
-				glTexImage2D(GL_TEXTURE_2D, 0, 3, textureWidth, textureHeight, 0, GL_BGR, GL_UNSIGNED_BYTE, imageData.get());
-			else if (4 == byteCount)
-				glTexImage2D(GL_TEXTURE_2D, 0, 4, textureWidth, textureHeight, 0, GL_BGRA, GL_UNSIGNED_BYTE, imageData.get());
+			int width, height;
+			const unsigned char* pixels = bundle.getLevel(level, width, height);
+			glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA, width, height, 0, GL_BGRA, GL_UNSIGNED_BYTE, pixels);
 		}
 
-		m_imageMap[spriteID] = glTextureID;
-
-		return true;
+		m_atlasTexture = glTextureID;
 	}
 
 	unsigned int getNumFrames(int imageID) const
@@ -133,48 +82,131 @@ public:
 		return it->second;
 	}
 
+	  // Batched drawing: addSprite() takes a sprite's position, angle, and
+	  // size plus a draw order, but only records the quad.  drawBatch() then
+	  // draws everything recorded since beginBatch() with one round of GL
+	  // state changes and one glDrawArrays per run of quads sharing a
+	  // texture.
+	  // Quads are drawn in increasing drawOrder; within one drawOrder they
+	  // are grouped by texture, so their order relative to each other is not
+	  // kept.
+
+	void beginBatch()
+	{
+		m_batch.clear();
+	}
 
-	bool plotSprite(int imageID, int frame, double gx, double gy, double gz, int angleDegrees, double size)
+	bool addSprite(int imageID, int frame, double gx, double gy, double gz, int angleDegrees, double size, int drawOrder)
 	{
-		unsigned int spriteID = getSpriteID(imageID,frame);
+		int spriteID = getSpriteID(imageID,frame);
 		if (INVALID_SPRITE_ID == spriteID)
 			return false;
 
 		auto it = m_imageMap.find(spriteID);
 		if (it == m_imageMap.end())
 			return false;
+		AtlasRect r = m_atlas.getRect(it->second);
 
-		glPushMatrix();
+		double rx[4], ry[4];
+		getCorners(SPRITE_WIDTH_GL * size, SPRITE_HEIGHT_GL * size, angleDegrees,
+				   rx[0], ry[0], rx[1], ry[1], rx[2], ry[2], rx[3], ry[3]);
 
-		double finalWidth, finalHeight;
+		const GLfloat cx[4] = { r.u0, r.u1, r.u1, r.u0 };
+		const GLfloat cy[4] = { r.v0, r.v0, r.v1, r.v1 };
 
-		finalWidth = SPRITE_WIDTH_GL * size;
-		finalHeight = SPRITE_HEIGHT_GL * size;
-
-		// object's x/y location is center-based, but sprite plotting is upper-left-corner based
-		const double xoffset = 0;// finalWidth / 2;
-		const double yoffset = 0;// finalHeight / 2;
+		BatchedQuad quad;
+		quad.drawOrder = drawOrder;
+		quad.texture = m_atlasTexture;
+		quad.sequence = m_batch.size();
+		for (int k = 0; k < 4; k++)
+		{
+			BatchVertex& v = quad.vertices[k];
+			v.u = cx[k];
+			v.v = cy[k];
+			v.x = static_cast<GLfloat>(gx + rx[k]);
+			v.y = static_cast<GLfloat>(gy + ry[k]);
+			v.z = static_cast<GLfloat>(gz);
+		}
+		m_batch.push_back(quad);
+		return true;
+	}
 
-		glTranslatef(static_cast<GLfloat>(gx-xoffset),static_cast<GLfloat>(gy-yoffset),static_cast<GLfloat>(gz));
-		glPushAttrib(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+	void drawBatch()
+	{
+		if (m_batch.empty())
+			return;
+
+		std::sort(m_batch.begin(), m_batch.end(),
+			[](const BatchedQuad& a, const BatchedQuad& b) {
+				if (a.drawOrder != b.drawOrder)
+					return a.drawOrder < b.drawOrder;
+				if (a.texture != b.texture)
+					return a.texture < b.texture;
+				return a.sequence < b.sequence;
+			});
+
+		m_batchVertices.clear();
+		for (size_t k = 0; k < m_batch.size(); k++)
+			m_batchVertices.insert(m_batchVertices.end(), m_batch[k].vertices, m_batch[k].vertices + 4);
+
+		glPushAttrib(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_ENABLE_BIT);
+		glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
 		glEnable(GL_TEXTURE_2D);
 		glDisable(GL_DEPTH_TEST);
 		glEnable (GL_BLEND);
 		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-		glBindTexture(GL_TEXTURE_2D, it->second);
-
 		glColor3f(1.0, 1.0, 1.0);
 
-		double cx1,cx2,cx3,cx4;
-		double cy1,cy2,cy3,cy4;
+		  // BatchVertex is laid out as GL_T2F_V3F expects
+		glInterleavedArrays(GL_T2F_V3F, 0, m_batchVertices.data());
 
-		cx1 = cy1 = 0;
-		cx2 = 1; cy2 = 0;
-		cx3 = 1; cy3 = 1;
-		cx4 = 0; cy4 = 1;
+		size_t first = 0;
+		while (first < m_batch.size())
+		{
+			size_t end = first + 1;
+			while (end < m_batch.size()  &&  m_batch[end].texture == m_batch[first].texture)
+				end++;
+			glBindTexture(GL_TEXTURE_2D, m_batch[first].texture);
+			glDrawArrays(GL_QUADS, static_cast<GLint>(4 * first), static_cast<GLsizei>(4 * (end - first)));
+			first = end;
+		}
+
+		glPopClientAttrib();
+		glPopAttrib();
+
+		m_batch.clear();
+	}
+
+	~SpriteManager()
+	{
+		if (m_atlasTexture != 0)
+			glDeleteTextures(1, &m_atlasTexture);
+	}
 
-		double rx1, ry1, rx2, ry2, rx3, ry3, rx4, ry4;
+private:
 
+	struct BatchVertex
+	{
+		GLfloat	u, v;
+		GLfloat	x, y, z;
+	};
+
+	struct BatchedQuad
+	{
+		int			drawOrder;
+		GLuint		texture;
+		size_t		sequence;	// keeps the sort deterministic
+		BatchVertex	vertices[4];
+	};
+
+	std::vector<BatchedQuad>	m_batch;
+	std::vector<BatchVertex>	m_batchVertices;
+
+	  // The corners of a sprite of the given size, centered on the origin
+	void getCorners(double finalWidth, double finalHeight, int angleDegrees,
+					double& rx1, double& ry1, double& rx2, double& ry2,
+					double& rx3, double& ry3, double& rx4, double& ry4)
+	{
 //#define FULL_ROTATION	// for games where you can rotate 360 degrees, not just n/s/e/w
 
 #ifndef FULL_ROTATION
@@ -202,58 +234,68 @@ public:
 		rotate(finalWidth / 2, finalHeight / 2, angleDegrees, rx3, ry3);
 		rotate(-finalWidth / 2, finalHeight / 2, angleDegrees, rx4, ry4);
 #endif  // FULL_ROTATION
+	}
+
+	  // Records which atlas cell each sprite is in
+	void addSprites(const BundleSprite sprites[], int numSprites, int atlasHeight)
+	{
+		for (int k = 0; k < numSprites; k++)
+		{
+			int spriteID = getSpriteID(sprites[k].imageID, sprites[k].frame);
+			if (INVALID_SPRITE_ID == spriteID)
+				continue;
+			m_frameCountPerSprite[sprites[k].imageID]++;	// keep track of how many frames per sprite we loaded
+			m_imageMap[spriteID] = sprites[k].cell;
+		}
+		m_atlas.restore(atlasHeight, numSprites);
+	}
 
-		glBegin(GL_QUADS);
-		glTexCoord2d(cx1, cy1);
-		glVertex3f(static_cast<GLfloat>(rx1), static_cast<GLfloat>(ry1), 0);
-		glTexCoord2d(cx2, cy2);
-		glVertex3f(static_cast<GLfloat>(rx2), static_cast<GLfloat>(ry2), 0);
-		glTexCoord2d(cx3, cy3);
-		glVertex3f(static_cast<GLfloat>(rx3), static_cast<GLfloat>(ry3), 0);
-		glTexCoord2d(cx4, cy4);
-		glVertex3f(static_cast<GLfloat>(rx4), static_cast<GLfloat>(ry4), 0);
-		glEnd();
-
-
-		/*
-		glBegin (GL_QUADS);
-		  glTexCoord2d(cx1, cy1);
-		  glVertex3f(0, 0, 0);
-		  glTexCoord2d(cx2, cy2);
-		  glVertex3f(static_cast<GLfloat>(finalWidth), 0, 0);
-		  glTexCoord2d(cx3, cy3);
-		  glVertex3f(static_cast<GLfloat>(finalWidth), static_cast<GLfloat>(finalHeight), 0);
-		  glTexCoord2d(cx4, cy4);
-		  glVertex3f(0, static_cast<GLfloat>(finalHeight), 0);
-		glEnd();
-		*/
-
-		glDisable(GL_TEXTURE_2D);
+	  // Makes and binds a texture for the atlas, with our usual parameters
+	GLuint makeTexture()
+	{
 		glEnable(GL_DEPTH_TEST);
 
-		glPopAttrib();
-		glPopMatrix();
+		  // allocate a texture handle
+		GLuint glTextureID;
+		glGenTextures(1, &glTextureID);
 
-		return true;
-	}
+		  // bind our new texture
+		glBindTexture(GL_TEXTURE_2D, glTextureID);
 
-	~SpriteManager()
-	{
-		for (auto it = m_imageMap.begin(); it != m_imageMap.end(); it++)
-			glDeleteTextures(1, &it->second);
-	}
+		glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
 
-private:
+		if (m_mipMapped)
+		{
+			  // when texture area is small, bilinear filter the closest mipmap
+			glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+			  // when texture area is large, bilinear filter the first mipmap
+			glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+		}
+		else
+		{
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		}
+
+		  // Have the texture wrap both vertically and horizontally.
+		glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, static_cast<GLfloat>(GL_REPEAT));
+		glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, static_cast<GLfloat>(GL_REPEAT));
+
+		return glTextureID;
+	}
 
-	void rotate(double x, double y, double degrees, double &xout, double &yout)
+	void rotate(double x, double y, int degrees, double &xout, double &yout)
 	{
-		double theta = degrees*1.0 / 360 * 2 * 3.14159;
-		xout = x * cos(theta) - y * sin(theta);
-		yout = y * cos(theta) + x * sin(theta);
+		double cosTheta = cosDegrees(degrees);
+		double sinTheta = sinDegrees(degrees);
+		xout = x * cosTheta - y * sinTheta;
+		yout = y * cosTheta + x * sinTheta;
 	}
 
 	bool							m_mipMapped;
-	std::map<unsigned int, GLuint>	m_imageMap;
+	TextureAtlas					m_atlas;
+	GLuint							m_atlasTexture;
+	std::map<unsigned int, int>		m_imageMap;		// sprite ID to atlas cell
 	std::map<unsigned int, unsigned int>		m_frameCountPerSprite;
 
 	static const int INVALID_SPRITE_ID = -1;
@@ -267,18 +309,6 @@ private:
 
 		return imageID * MAX_FRAMES_PER_SPRITE + frame;
 	}
-
-    static void makeMipmaps(unsigned char byteCount, unsigned int textureWidth, unsigned int textureHeight, char* imageData)
-    {
-        int format = (byteCount == 3 ? GL_BGR : GL_BGRA);
-#ifdef __APPLE__
-        int internalFormat = (byteCount == 3 ? GL_RGB : GL_RGBA);
-        glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, textureWidth, textureHeight, 0, format, GL_UNSIGNED_BYTE, imageData);
-        glGenerateMipmap(GL_TEXTURE_2D);
-#else
-        gluBuild2DMipmaps(GL_TEXTURE_2D, byteCount, textureWidth, textureHeight, format, GL_UNSIGNED_BYTE, imageData);
-#endif
-    }
 };
 
 #endif // SPRITEMANAGER_H_
@@ -1,9 +1,12 @@
 #include "StudentWorld.h"
 #include "Actor.h"
 #include "GameConstants.h"
+#include "Profiler.h"
 #include <string>
 #include <iostream> // defines the overloads of the << operator
-#include <sstream>  // defines the type std::ostringstream
+#include <algorithm>
+#include <cmath>
+#include <chrono>
 using namespace std;
 
 
@@ -21,17 +24,29 @@ StudentWorld::StudentWorld(string assetPath)
     : GameWorld(assetPath)
 {
     m_ghostRacer = nullptr;
-    m_lastYCord = 0;
     m_bonusPoints = 0;
     m_souls2save = 0;
+    m_actorGridIsCurrent = false;
+    m_sprayChecksThisTick = 0;
+    m_laneIndexIsCurrent = false;
+    m_phaseTimes = nullptr;
+    m_displayedStats = DisplayStats{ -1, -1, -1, -1, -1, -1, -1 };   // Nothing displayed yet
+    m_displayText.reserve(DISPLAY_TEXT_CAPACITY);
+
+    // Yellow road edges and white lane dividers are drawn by the framework as
+    // scrolling stripes, not as actors
+    addRoadStripe(IID_YELLOW_BORDER_LINE, LEFT_EDGE, SPRITE_HEIGHT, BORDER_SIZE, BORDER_DEPTH);
+    addRoadStripe(IID_YELLOW_BORDER_LINE, RIGHT_EDGE, SPRITE_HEIGHT, BORDER_SIZE, BORDER_DEPTH);
+    addRoadStripe(IID_WHITE_BORDER_LINE, LEFT_EDGE + LANE_WIDTH, WHITE_BORDER_SPACING, BORDER_SIZE, BORDER_DEPTH);
+    addRoadStripe(IID_WHITE_BORDER_LINE, RIGHT_EDGE - LANE_WIDTH, WHITE_BORDER_SPACING, BORDER_SIZE, BORDER_DEPTH);
 }
 
 
 // Initializes current level: creates GhostRacer, borders, bonus points, souls
 int StudentWorld::init()
 {
-    m_ghostRacer = new GhostRacer(this);
-    initializeBorders();
+    m_ghostRacer = constructActor<GhostRacer>();
+    setRoadOffset(0);
     m_bonusPoints = BONUS_POINTS;
     m_souls2save = 2 * getLevel() + 5;
     return GWSTATUS_CONTINUE_GAME;
@@ -39,19 +54,65 @@ int StudentWorld::init()
 
 // Executes actions of level each tick (20 times per second)
 int StudentWorld::move()
+{
+    chrono::steady_clock::time_point lap;
+    if (m_phaseTimes != nullptr)
+    {
+        lap = chrono::steady_clock::now();
+    }
+    int status = updateActors();
+    lapPhase(lap, &PhaseTimes::update);
+    if (status != GWSTATUS_CONTINUE_GAME)
+    {
+        return status;
+    }
+    removeDeadActors();
+    lapPhase(lap, &PhaseTimes::sweep);
+    addNewActors();
+    lapPhase(lap, &PhaseTimes::spawn);
+    updateDisplayText();
+
+    // The player hasnt completed the current level and hasnt died, so
+    // continue playing the current level
+    return GWSTATUS_CONTINUE_GAME;
+}
+
+void StudentWorld::lapPhase(chrono::steady_clock::time_point& lap, long long PhaseTimes::* phase)
+{
+    if (m_phaseTimes == nullptr)
+    {
+        return;
+    }
+    chrono::steady_clock::time_point now = chrono::steady_clock::now();
+    m_phaseTimes->*phase += chrono::duration_cast<chrono::nanoseconds>(now - lap).count();
+    lap = now;
+}
+
+// Lets GhostRacer and every living actor do something; returns the status the
+// level ends with if GhostRacer died or all souls were saved
+int StudentWorld::updateActors()
 {
     decreaseBonusPoints();              // Decrease bonus by each tick
+    indexLanes();
+    m_actorGridIsCurrent = false;
+    m_sprayChecksThisTick = 0;
     if (! m_ghostRacer->isDead())
     {
+        PROFILE_SCOPE(PROFILE_RACER);
         m_ghostRacer->doSomething();
     }
-    list<Actor*>::iterator it;
-    for (it = m_actors.begin(); it != m_actors.end(); it++)
+    scrollBorders();
+
+    PROFILE_SCOPE(PROFILE_ACTORS);
+    // Index rather than iterate: actors spawned during this loop (sprays, goodies)
+    // are appended to m_actors and still get to move this tick
+    for (size_t i = 0; i < m_actors.size(); i++)
     {
         // Allow each actor to do something if they're alive
-        if (! (*it)->isDead())
+        Actor* actor = m_actors[i];
+        if (! actor->isDead())
         {
-            (*it)->doSomething();
+            actor->doSomething();
         }
 
         // If GhostRacer is dead, immediately end level to game over or restart
@@ -68,49 +129,71 @@ int StudentWorld::move()
             return GWSTATUS_FINISHED_LEVEL;
         }
     }
+    return GWSTATUS_CONTINUE_GAME;
+}
 
-    // Remove newly-dead actors after each tick
-    for (it = m_actors.begin(); it != m_actors.end();)
+// Removes newly-dead actors after each tick, in one compaction pass that keeps
+// the survivors in spawn order
+void StudentWorld::removeDeadActors()
+{
+    PROFILE_SCOPE(PROFILE_SWEEP);
+    m_laneIndexIsCurrent = false;   // Actors have moved since it was built, and some die here
+    size_t numAlive = 0;
+    for (size_t i = 0; i < m_actors.size(); i++)
     {
-        if ((*it)->isDead())
+        if (m_actors[i]->isDead())
         {
-            delete (*it);
-            it = m_actors.erase(it);
+            destroyActor(m_actors[i]);
         }
         else
         {
-            it++;
+            m_actors[numAlive++] = m_actors[i];
         }
     }
+    m_actors.resize(numAlive);
+}
 
-    // Potentially add new actors to the game 
-    addNewBorderLines();
+// Potentially adds new actors to the game
+void StudentWorld::addNewActors()
+{
     addNewHumanPeds();
     addNewZombiePeds();
     addNewZombieCabs();
     addNewOilSlicks();
     addNewHolyWaterRefillGoodies();
     addNewLostSoulGoodies();
+}
 
-    // Update the Game Status Line
-    setGameStatText(formatDisplayText());
-
-    // The player hasnt completed the current level and hasnt died, so
-    // continue playing the current level
-    return GWSTATUS_CONTINUE_GAME;
+// Updates the Game Status Line, if anything on it changed
+void StudentWorld::updateDisplayText()
+{
+    PROFILE_SCOPE(PROFILE_HUD);
+    DisplayStats stats = { getScore(), getLevel(), m_souls2save, getLives(),
+        m_ghostRacer->getHealth(), m_ghostRacer->getNumSprays(), m_bonusPoints };
+    if (stats == m_displayedStats)
+    {
+        return;
+    }
+    m_displayedStats = stats;
+    formatDisplayText(stats);
+    setGameStatText(m_displayText);
 }
 
 
 // Deletes all remaining actors (including GhostRacer)
 void StudentWorld::cleanUp()
 {
-    delete m_ghostRacer;
-    list<Actor*>::iterator it;
-    for (it = m_actors.begin(); it != m_actors.end();)
+    if (m_ghostRacer != nullptr)
+    {
+        destroyActor(m_ghostRacer);
+        m_ghostRacer = nullptr;
+    }
+    for (size_t i = 0; i < m_actors.size(); i++)
     {
-        delete (*it);
-        it = m_actors.erase(it);
+        destroyActor(m_actors[i]);
     }
+    m_actors.clear();
+    m_laneIndexIsCurrent = false;
 }
 
 StudentWorld::~StudentWorld()
@@ -118,83 +201,80 @@ StudentWorld::~StudentWorld()
     cleanUp();
 }
 
+// Destroys an actor and returns its memory to the actor pool
+void StudentWorld::destroyActor(Actor* a)
+{
+    void* slot = dynamic_cast<void*>(a);
+    a->~Actor();
+    m_actorPool.deallocate(slot);
+}
+
 
 ///////////////////////////////////////////////////////////////////////////
 // Init() Helper Functions
 ///////////////////////////////////////////////////////////////////////////
 
-// Adds initial borders on screen before level begins
-void StudentWorld::initializeBorders()
-{
-    const int NUM_YELLOW_BORDER = VIEW_HEIGHT / SPRITE_HEIGHT;
-    const int NUM_WHITE_BORDER = VIEW_HEIGHT / (4 * SPRITE_HEIGHT);
+///////////////////////////////////////////////////////////////////////////
+// Move() Helper Functions
+///////////////////////////////////////////////////////////////////////////
 
-    // Add NUM_YELLOW_BORDER yellow border line objects on left and right
-    for (int j = 0; j < NUM_YELLOW_BORDER; j++)
+// Appends the decimal digits of n to text (which has room reserved, so
+// nothing is allocated)
+static void appendInt(string& text, int n)
+{
+    char digits[12];
+    int numDigits = 0;
+    unsigned int magnitude = (n < 0 ? 0u - static_cast<unsigned int>(n) : static_cast<unsigned int>(n));
+    do
+    {
+        digits[numDigits++] = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (n < 0)
     {
-        // Left Yellow BorderLines
-        m_actors.push_back(new BorderLine(this, LEFT_EDGE, j * SPRITE_HEIGHT, true));
-        // Right Yellow BorderLines
-        m_actors.push_back(new BorderLine(this, RIGHT_EDGE, j * SPRITE_HEIGHT, true));
+        text += '-';
     }
-
-    // Add NUM_WHITE_BORDER white border line objects on left and right
-    for (int j = 0; j < NUM_WHITE_BORDER; j++)
+    while (numDigits > 0)
     {
-        // Left White BorderLines
-        m_actors.push_back(new BorderLine(this, LEFT_EDGE + LANE_WIDTH, j * (4 * SPRITE_HEIGHT), false));
-        // Right White BorderLines
-        m_actors.push_back(new BorderLine(this, RIGHT_EDGE - LANE_WIDTH, j * (4 * SPRITE_HEIGHT), false));
+        text += digits[--numDigits];
     }
-    // Saves y coordinate of last white border line added 
-    m_lastYCord = (NUM_WHITE_BORDER - 1) * (4 * SPRITE_HEIGHT);
 }
 
+// Formats the stats displayed on the top of each level into m_displayText
+void StudentWorld::formatDisplayText(const DisplayStats& stats)
+{
+    m_displayText.clear();
+    m_displayText += "Score: ";
+    appendInt(m_displayText, stats.score);
+    m_displayText += "  Lvl: ";
+    appendInt(m_displayText, stats.level);
+    m_displayText += "  Souls2Save: ";
+    appendInt(m_displayText, stats.souls2save);
+    m_displayText += "  Lives: ";
+    appendInt(m_displayText, stats.lives);
+    m_displayText += "  Health: ";
+    appendInt(m_displayText, stats.health);
+    m_displayText += "  Sprays: ";
+    appendInt(m_displayText, stats.sprays);
+    m_displayText += "  Bonus: ";
+    appendInt(m_displayText, stats.bonus);
+}
 
-///////////////////////////////////////////////////////////////////////////
-// Move() Helper Functions
-///////////////////////////////////////////////////////////////////////////
-
-// Formats the stats displayed on the top of each level
-string StudentWorld::formatDisplayText()
+// Scrolls the border lines by how fast they move relative to GhostRacer
+void StudentWorld::scrollBorders()
 {
-    ostringstream displayText;
-    displayText << "Score: " << getScore() << "  Lvl: " << getLevel() << "  Souls2Save: " << m_souls2save
-        << "  Lives: " << getLives() << "  Health: " << m_ghostRacer->getHealth() <<
-        "  Sprays: " << m_ghostRacer->getNumSprays() << "  Bonus: " << m_bonusPoints;
-    string display = displayText.str();
-    return display;
+    // Every stripe pattern repeats every WHITE_BORDER_SPACING pixels, so keep the
+    // offset within one period
+    double offset = getRoadOffset() + BORDER_SPEED - m_ghostRacer->getYVelocity();
+    setRoadOffset(fmod(offset, WHITE_BORDER_SPACING));
 }
 
 ///////////////////////////
 // Add New Actor Methods //
 ///////////////////////////
 
-// Adds new borderlines if some have gone off the screen
-void StudentWorld::addNewBorderLines()
-{
-    m_lastYCord += BORDER_SPEED - m_ghostRacer->getYVelocity();
-    double new_border_y = VIEW_HEIGHT - SPRITE_HEIGHT;
-    double delta_y = new_border_y - m_lastYCord;
-
-    if (delta_y >= SPRITE_HEIGHT)
-    {
-        // Add left and right yellow border lines
-        m_actors.push_back(new BorderLine(this, LEFT_EDGE, new_border_y, true));
-        m_actors.push_back(new BorderLine(this, RIGHT_EDGE, new_border_y, true));
-
-    }
-    if (delta_y >= (4 * SPRITE_HEIGHT))
-    {
-        // Add left and right white border lines
-        m_actors.push_back(new BorderLine(this, LEFT_EDGE + LANE_WIDTH, new_border_y, false));
-        m_actors.push_back(new BorderLine(this, RIGHT_EDGE - LANE_WIDTH, new_border_y, false));
-        m_lastYCord = new_border_y;
-    }
-}
-
 // Calculates chance of adding a new actor to the level
-bool StudentWorld::chanceOf(int left, int right) const
+bool StudentWorld::chanceOf(int left, int right)
 {
     int chance = max(left, right);
     int rand = randInt(0, chance - 1);
@@ -204,20 +284,23 @@ bool StudentWorld::chanceOf(int left, int right) const
 // Attempts to add new human pedestrians based on chance
 void StudentWorld::addNewHumanPeds()
 {
+    PROFILE_SCOPE(PROFILE_ADD_HUMAN_PEDS);
     if (chanceOf(200 - getLevel() * 10, 30))
-        m_actors.push_back(new HumanPedestrian(this, randInt(0, VIEW_WIDTH), VIEW_HEIGHT));
+        addActor<HumanPedestrian>(randInt(0, VIEW_WIDTH), VIEW_HEIGHT);
 }
 
 // Attempts to add new zombie pedestrians based on chance
 void StudentWorld::addNewZombiePeds()
 {
+    PROFILE_SCOPE(PROFILE_ADD_ZOMBIE_PEDS);
     if (chanceOf(100 - getLevel() * 10, 20))
-        m_actors.push_back(new ZombiePedestrian(this, randInt(0, VIEW_WIDTH), VIEW_HEIGHT));
+        addActor<ZombiePedestrian>(randInt(0, VIEW_WIDTH), VIEW_HEIGHT);
 }
 
 // Attempts to add new zombie cabs based on chance
 void StudentWorld::addNewZombieCabs()
 {
+    PROFILE_SCOPE(PROFILE_ADD_ZOMBIE_CABS);
     if (chanceOf(100 - getLevel() * 10, 20))
         attemptToAddZombieCab();
 }
@@ -225,22 +308,25 @@ void StudentWorld::addNewZombieCabs()
 // Attempts to add new oil slicks based on chance
 void StudentWorld::addNewOilSlicks()
 {
+    PROFILE_SCOPE(PROFILE_ADD_OIL_SLICKS);
     if (chanceOf(150 - getLevel() * 10, 40))
-        m_actors.push_back(new OilSlick(this, randInt(LEFT_EDGE, RIGHT_EDGE), VIEW_HEIGHT));
+        addActor<OilSlick>(randInt(LEFT_EDGE, RIGHT_EDGE), VIEW_HEIGHT);
 }
 
 // Attempts to add new holy water refills based on chance
 void StudentWorld::addNewHolyWaterRefillGoodies()
 {
+    PROFILE_SCOPE(PROFILE_ADD_HOLY_WATER);
     if (chanceOf(100 + 10 * getLevel(), 0))
-        m_actors.push_back(new HolyWaterGoodie(this, randInt(LEFT_EDGE, RIGHT_EDGE), VIEW_HEIGHT));
+        addActor<HolyWaterGoodie>(randInt(LEFT_EDGE, RIGHT_EDGE), VIEW_HEIGHT);
 }
 
 // Attempts to add new lost souls based on chance
 void StudentWorld::addNewLostSoulGoodies()
 {
+    PROFILE_SCOPE(PROFILE_ADD_LOST_SOULS);
     if(chanceOf(100, 0))
-        m_actors.push_back(new SoulGoodie(this, randInt(LEFT_EDGE, RIGHT_EDGE), VIEW_HEIGHT));
+        addActor<SoulGoodie>(randInt(LEFT_EDGE, RIGHT_EDGE), VIEW_HEIGHT);
 }
 
 
@@ -293,9 +379,8 @@ void StudentWorld::attemptToAddZombieCab()
         return;
     }
 
-    Actor* newZombieCab = new ZombieCab(this, startX, startY);
+    Actor* newZombieCab = addActor<ZombieCab>(startX, startY);
     newZombieCab->setYVelocity(initialYVel);
-    m_actors.push_back(newZombieCab);
 }
 
 // Returns the y coordinate of the closest actor ABOVE the reference x and y coordinates
@@ -303,41 +388,26 @@ void StudentWorld::attemptToAddZombieCab()
 // Check INCLUDES GhostRacer
 int StudentWorld::getClosestAbove(double refX, double refY)
 {
-    vector<double> possibleYCords;
-    bool foundActorInLane = false;
+    if (! m_laneIndexIsCurrent)
+    {
+        indexLanes();
+    }
+    double min = 999;
     int curLane = determineLaneNumber(refX);
     // GhostRacer included
     if (determineLaneNumber(m_ghostRacer->getX()) == curLane && m_ghostRacer->getY() > refY)
     {
-        possibleYCords.push_back(m_ghostRacer->getY());
-        foundActorInLane = true;
+        min = m_ghostRacer->getY();
     }
 
-    for (list<Actor*>::iterator it = m_actors.begin(); it != m_actors.end(); it++)
+    // Smallest y coordinate in the lane of refX that is GREATER than refY
+    const vector<double>& laneYCords = m_laneYCords[laneIndex(curLane)];
+    vector<double>::const_iterator it = upper_bound(laneYCords.begin(), laneYCords.end(), refY);
+    if (it != laneYCords.end() && (*it) < min)
     {
-        if ((*it)->isCollisionAvoidanceWorthy())
-        {
-            if (determineLaneNumber((*it)->getX()) == curLane && (*it)->getY() > refY)
-            {
-                possibleYCords.push_back((*it)->getY());
-                foundActorInLane = true;
-            }
-        }
+        min = (*it);
     }
-
-    // Find the minimum of all eligble y coordinates
-    double min = 999;
-    for (vector<double>::iterator it = possibleYCords.begin(); it != possibleYCords.end(); it++)
-    {
-        if ((*it) < min)
-        {
-            min = (*it);
-        }
-    }
-
-    if (foundActorInLane)
-        return min;
-    return 999;
+    return min;
 }
 
 // Returns the y coordinate of the closest actor BELOW the reference x and y coordinates
@@ -345,36 +415,57 @@ int StudentWorld::getClosestAbove(double refX, double refY)
 // Check EXCLUDES GhostRacer
 int StudentWorld::getClosestBelow(double refX, double refY)
 {
-    vector<double> possibleYCords;
-    bool foundActorInLane = false;
-    int curLane = determineLaneNumber(refX);
-
-    // Gather all possible y coordinates in the lane of refX that are LESS than refY
-    for (list<Actor*>::iterator it = m_actors.begin(); it != m_actors.end(); it++)
+    // Largest y coordinate in the lane of refX that is LESS than refY
+    if (! m_laneIndexIsCurrent)
     {
-        if ((*it)->isCollisionAvoidanceWorthy())
-        {
-            if (determineLaneNumber((*it)->getX()) == curLane && (*it)->getY() < refY)
-            {
-                possibleYCords.push_back((*it)->getY());
-                foundActorInLane = true;
-            }
-        }
+        indexLanes();
+    }
+    const vector<double>& laneYCords = m_laneYCords[laneIndex(determineLaneNumber(refX))];
+    vector<double>::const_iterator it = lower_bound(laneYCords.begin(), laneYCords.end(), refY);
+    if (it != laneYCords.begin())
+    {
+        return *(it - 1);
     }
+    return -999;
+}
 
-    // Find max of all eligible y coordinates
-    double max = -999;
-    for (vector<double>::iterator it = possibleYCords.begin(); it != possibleYCords.end(); it++)
+// Records the y coordinate of every collision avoidance worthy actor in the lane it
+// is in, sorted, so getClosestAbove and getClosestBelow can binary search a lane.
+// Done once per tick, before anything moves, so queries made while actors move
+// see where actors were when the tick began.
+//
+// Once actors have moved and the dead are swept, that index is stale, but a new
+// zombie cab still has to be placed by where actors are now, or it can spawn on top
+// of an actor that has moved into its path (or be kept out of a lane by one that
+// has died).  So the sweep marks the index stale, the first query after that
+// rebuilds it once, and actors added after that are inserted into it directly.
+void StudentWorld::indexLanes()
+{
+    m_laneIndexIsCurrent = true;
+    for (int i = 0; i < NUM_LANE_INDEXES; i++)
     {
-        if ((*it) > max)
+        m_laneYCords[i].clear();
+    }
+    for (size_t i = 0; i < m_actors.size(); i++)
+    {
+        if (m_actors[i]->isCollisionAvoidanceWorthy())
         {
-            max = (*it);
+            m_laneYCords[laneIndex(determineLaneNumber(m_actors[i]->getX()))].push_back(m_actors[i]->getY());
         }
     }
+    for (int i = 0; i < NUM_LANE_INDEXES; i++)
+    {
+        sort(m_laneYCords[i].begin(), m_laneYCords[i].end());
+    }
+}
 
-    if (foundActorInLane)
-        return max;
-    return -999;
+void StudentWorld::indexNewActor(const Actor* a)
+{
+    if (m_laneIndexIsCurrent && a->isCollisionAvoidanceWorthy())
+    {
+        vector<double>& laneYCords = m_laneYCords[laneIndex(determineLaneNumber(a->getX()))];
+        laneYCords.insert(upper_bound(laneYCords.begin(), laneYCords.end(), a->getY()), a->getY());
+    }
 }
 
 // Returns true if the given x coordinate x1, is within the left and right bounds
@@ -413,7 +504,7 @@ bool StudentWorld::overlaps(const Actor* a1, const Actor* a2) const
     double delta_y = fabs(a1->getY() - a2->getY());
     double radius_sum = a1->getRadius() + a2->getRadius();
 
-    if (delta_x < (radius_sum * 0.25) && delta_y < (radius_sum * 0.6))
+    if (delta_x < (radius_sum * OVERLAP_X_FRACTION) && delta_y < (radius_sum * OVERLAP_Y_FRACTION))
     {
         return true;	// The two actors overlap
     }
@@ -435,18 +526,54 @@ GhostRacer* StudentWorld::getOverlappingGhostRacer(Actor* a) const
 // otherwise, return false.  (See Actor::beSprayedIfAppropriate.)
 bool StudentWorld::sprayFirstAppropriateActor(Actor* a)
 {
-    list<Actor*>::iterator it;
-    for (it = m_actors.begin(); it != m_actors.end(); it++)
+    // Until this tick's sprays have checked as many actors as building the grid
+    // would visit, checking every actor in spawn order is cheaper (on a crowded
+    // road a spray usually hits one of the first few actors it checks)
+    if (! m_actorGridIsCurrent && m_sprayChecksThisTick < m_actors.size())
     {
-        if ((*it)->isDead())
-            continue;
-        if (overlaps(a, (*it)) && (*it)->beSprayedIfAppropriate())
+        // Index rather than iterate: spraying an actor can kill it and drop a goodie,
+        // which appends to (and may reallocate) m_actors
+        for (size_t i = 0; i < m_actors.size(); i++)
+        {
+            m_sprayChecksThisTick++;
+            if (sprayIfAppropriate(a, m_actors[i]))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // After that, only check actors near the spray.  Candidates are in spawn order,
+    // followed by any actors spawned since the grid was built, so the first
+    // appropriate actor is the same one a scan of every actor would find.
+    if (! m_actorGridIsCurrent)
+    {
+        m_actorGrid.build(m_actors, m_ghostRacer->getYVelocity());
+        m_actorGridIsCurrent = true;
+    }
+    double reach = a->getRadius() + m_actorGrid.getMaxRadius();
+    m_actorGrid.findNear(a->getX(), a->getY(), reach * OVERLAP_X_FRACTION, reach * OVERLAP_Y_FRACTION, m_sprayCandidates);
+    for (size_t i = m_actorGrid.getNumIndexed(); i < m_actors.size(); i++)
+    {
+        m_sprayCandidates.push_back(i);
+    }
+
+    for (size_t i = 0; i < m_sprayCandidates.size(); i++)
+    {
+        if (sprayIfAppropriate(a, m_actors[m_sprayCandidates[i]]))
         {
             return true;
         }
     }
     return false;
+}
 
+// If target is alive, overlaps actor a and is affected by holy water, inflict a
+// holy water spray on it and return true; otherwise, return false
+bool StudentWorld::sprayIfAppropriate(Actor* a, Actor* target)
+{
+    return ! target->isDead() && overlaps(a, target) && target->beSprayedIfAppropriate();
 }
 
 
@@ -2,8 +2,13 @@
 #define STUDENTWORLD_INCLUDED
 
 #include "GameWorld.h"
+#include "ActorPool.h"
+#include "ActorGrid.h"
 #include <string>
-#include <list>
+#include <vector>
+#include <new>
+#include <utility>
+#include <chrono>
 using namespace std;
 
 ///////////////////////////////////////////////////////////////////////////
@@ -21,8 +26,17 @@ const int LEFT_LANE = 1;
 const int MIDDLE_LANE = 2;
 const int RIGHT_LANE = 3;
 
+// Two actors overlap if their centers are closer than these fractions of the sum
+// of their radii, horizontally and vertically
+const double OVERLAP_X_FRACTION = 0.25;
+const double OVERLAP_Y_FRACTION = 0.6;
+
 const int BORDER_SPEED = -4;
+const int WHITE_BORDER_SPACING = 4 * SPRITE_HEIGHT;
+const double BORDER_SIZE = 2.0;
+const int BORDER_DEPTH = 2;
 const int BONUS_POINTS = 5000;
+const int DISPLAY_TEXT_CAPACITY = 128;   // Longer than the stats line ever gets
 
 ///////////////////////////////////////////////////////////////////////////
 // Student World 
@@ -46,6 +60,21 @@ public:
     // Deletes all remaining actors (including GhostRacer)
     virtual void cleanUp();
 
+    // Number of actors in the world (excluding GhostRacer)
+    int getNumActors() const { return m_actors.size(); }
+
+    // Nanoseconds spent in each phase of move(), added up over every tick
+    struct PhaseTimes
+    {
+        long long update = 0;   // GhostRacer and the actors doing something
+        long long sweep = 0;    // removing dead actors
+        long long spawn = 0;    // adding new ones
+    };
+
+    // While times isn't nullptr, each tick's phases are timed and added to it
+    // (the benchmark's breakdown; the game leaves this off)
+    void timePhases(PhaseTimes* times) { m_phaseTimes = times; }
+
     //////////////////////////////////////
     // Public Actor Interaction Methods //
     //////////////////////////////////////
@@ -60,8 +89,16 @@ public:
     // GhostRacer; otherwise, return nullptr
     GhostRacer* getOverlappingGhostRacer(Actor* a) const;
 
-    // Add an actor to the world
-    void addActor(Actor* a) { m_actors.push_back(a); }
+    // Construct a new actor of type T in this world (the world itself is passed
+    // as the first constructor argument), add it to the world and return it
+    template <typename T, typename... Args>
+    T* addActor(Args&&... args)
+    {
+        T* a = constructActor<T>(std::forward<Args>(args)...);
+        m_actors.push_back(a);
+        indexNewActor(a);
+        return a;
+    }
 
     // Record that a soul was saved
     void recordSoulSaved() { m_souls2save--; }
@@ -82,17 +119,61 @@ public:
     int getClosestBelow(double refX, double refY);
 
 private:
-    list<Actor*> m_actors;      // Container that stores all actors in game (except for GhostRacer)
+    ActorPool m_actorPool;      // Memory for every actor in this world (including GhostRacer)
+    vector<Actor*> m_actors;    // All actors in game (except for GhostRacer), in spawn order
     GhostRacer* m_ghostRacer;   // Pointer to this world's GhostRacer
-    double m_lastYCord;         // Y Coordinate of the last white borderline added 
     int m_bonusPoints;          // Bonus points in current level   
     int m_souls2save;           // Number of souls to save before level ends
 
+    // Sorted y coordinates of collision avoidance worthy actors, one vector per lane
+    // (index 0 holds actors that are off the road)
+    static const int NUM_LANE_INDEXES = 4;
+    vector<double> m_laneYCords[NUM_LANE_INDEXES];
+    bool m_laneIndexIsCurrent;      // Does m_laneYCords match where the actors are now?
+
+    ActorGrid m_actorGrid;          // Actors bucketed by position, built when sprays need it
+    bool m_actorGridIsCurrent;      // Has m_actorGrid been built this tick?
+    size_t m_sprayChecksThisTick;   // Actors checked by sprays this tick without the grid
+    vector<int> m_sprayCandidates;  // Scratch space for sprayFirstAppropriateActor
+    PhaseTimes* m_phaseTimes;       // Where to add phase times, if anywhere
+
+    // If phases are being timed, adds the time since lap to the given phase
+    // and moves lap up to now
+    void lapPhase(std::chrono::steady_clock::time_point& lap, long long PhaseTimes::* phase);
+
+    ////////////////////////////////
+    // Phases of move(), in order //
+    ////////////////////////////////
+
+    // Lets GhostRacer and every living actor do something; returns the status the
+    // level ends with if GhostRacer died or all souls were saved
+    int updateActors();
+
+    // Removes newly-dead actors
+    void removeDeadActors();
+
+    // Potentially adds new actors to the game
+    void addNewActors();
+
+    // Updates the Game Status Line
+    void updateDisplayText();
+
+    // Constructs a new actor of type T in a slot from the actor pool
+    template <typename T, typename... Args>
+    T* constructActor(Args&&... args)
+    {
+        static_assert(sizeof(T) <= ActorPool::SLOT_SIZE, "actor type does not fit in an ActorPool slot");
+        return new (m_actorPool.allocate()) T(this, std::forward<Args>(args)...);
+    }
+
+    // Destroys an actor and returns its memory to the actor pool
+    void destroyActor(Actor* a);
+
     // Doesn't allow bonus points to reach a negative value
     void decreaseBonusPoints() { m_bonusPoints--; if (m_bonusPoints < 0) { m_bonusPoints = 0; } }
 
     // Calculates chance of adding a new actor to the level
-    bool chanceOf(int left, int right) const;
+    bool chanceOf(int left, int right);
 
     // Determines which lane the given x coordinate is in (assumes left and right boundary
     // are valid lane parameters)
@@ -101,14 +182,42 @@ private:
     // Determines lane number of given x coordinate
     int determineLaneNumber(double x1) const;
 
-    // Formats the stats displayed on the top of each level
-    string formatDisplayText();
+    // Maps a lane number to its index in m_laneYCords
+    int laneIndex(int lane) const { return (lane >= LEFT_LANE && lane <= RIGHT_LANE) ? lane : 0; }
+
+    // Rebuilds m_laneYCords from the current actor positions
+    void indexLanes();
+
+    // Adds a just-added actor to m_laneYCords, if it is current
+    void indexNewActor(const Actor* a);
+
+    // If target is alive, overlaps actor a and is affected by holy water, inflict a
+    // holy water spray on it and return true; otherwise, return false
+    bool sprayIfAppropriate(Actor* a, Actor* target);
+
+    // The stats displayed on the top of each level
+    struct DisplayStats
+    {
+        int score, level, souls2save, lives, health, sprays, bonus;
+
+        bool operator==(const DisplayStats& other) const
+        {
+            return score == other.score && level == other.level && souls2save == other.souls2save &&
+                lives == other.lives && health == other.health && sprays == other.sprays && bonus == other.bonus;
+        }
+    };
+    DisplayStats m_displayedStats;  // As last passed to setGameStatText
+    string m_displayText;           // Reused, so formatting doesn't allocate
+
+    // Formats the stats displayed on the top of each level into m_displayText
+    void formatDisplayText(const DisplayStats& stats);
+
+    // Scrolls the border lines by how fast they move relative to GhostRacer
+    void scrollBorders();
 
     ///////////////////////////
     // Add New Actor Methods //
     ///////////////////////////
-    void initializeBorders();
-    void addNewBorderLines();
     void addNewHumanPeds();
     void addNewZombiePeds();
     void addNewZombieCabs();
@@ -0,0 +1,38 @@
+#include "TGAFile.h"
+#include <string>
+#include <vector>
+#include <fstream>
+using namespace std;
+
+bool loadTGA(string filename, TGAImage& image)
+{
+	ifstream tgaFile(filename, ios::in|ios::binary);
+	if (!tgaFile)
+		return false;
+
+	char type[3];
+	char info[6];
+
+	  // Read file header info
+	tgaFile.read(type, 3);
+	tgaFile.seekg(12);
+	tgaFile.read(info, 6);
+	if (!tgaFile)
+		return false;
+
+	  //image type either 2 (color) or 3 (greyscale)
+	if (type[1] != 0 || (type[2] != 2 && type[2] != 3))
+		return false;
+
+	image.width = static_cast<unsigned char>(info[0]) + static_cast<unsigned char>(info[1]) * 256;
+	image.height = static_cast<unsigned char>(info[2]) + static_cast<unsigned char>(info[3]) * 256;
+	image.bytesPerPixel = static_cast<unsigned char>(info[4]) / 8;
+	if (image.bytesPerPixel != 3 && image.bytesPerPixel != 4)
+		return false;
+
+	  // Read image data
+	image.pixels.resize(size_t(image.width) * image.height * image.bytesPerPixel);
+	tgaFile.seekg(18);
+	tgaFile.read(reinterpret_cast<char*>(image.pixels.data()), image.pixels.size());
+	return static_cast<bool>(tgaFile);
+}
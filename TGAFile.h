@@ -0,0 +1,22 @@
+#ifndef TGAFILE_H_
+#define TGAFILE_H_
+
+#include <string>
+#include <vector>
+
+  // The pixels of an uncompressed TGA file: BGR (bytesPerPixel 3) or BGRA
+  // (4), with the rows in the order they are stored in the file.
+
+struct TGAImage
+{
+	unsigned int	width = 0;
+	unsigned int	height = 0;
+	unsigned int	bytesPerPixel = 0;
+	std::vector<unsigned char> pixels;
+};
+
+  // Returns false if the file can't be read or isn't an uncompressed color
+  // TGA with 24 or 32 bit pixels
+bool loadTGA(std::string filename, TGAImage& image);
+
+#endif // TGAFILE_H_
@@ -0,0 +1,181 @@
+#include "TextureAtlas.h"
+#include <vector>
+#include <algorithm>
+#include <cmath>
+using namespace std;
+
+static const int CHANNELS = 4;	// BGRA
+
+  // How much each source pixel contributes to one destination pixel
+struct Tap
+{
+	int		source;
+	float	weight;
+};
+
+  // Filter taps for scaling a row (or column) of srcSize pixels to dstSize:
+  // when shrinking, each destination pixel averages the source pixels it
+  // covers (weighted by how much of each it covers); when enlarging, it
+  // interpolates between the two nearest.
+static vector<vector<Tap>> makeTaps(int srcSize, int dstSize)
+{
+	vector<vector<Tap>> taps(dstSize);
+	double scale = double(srcSize) / dstSize;
+	for (int d = 0; d < dstSize; d++)
+	{
+		vector<Tap>& t = taps[d];
+		if (scale >= 1)
+		{
+			double from = d * scale;
+			double to = from + scale;
+			for (int s = int(from); s < to  &&  s < srcSize; s++)
+			{
+				double covered = min<double>(s + 1, to) - max<double>(s, from);
+				if (covered > 0)
+					t.push_back(Tap{ s, float(covered / scale) });
+			}
+		}
+		else
+		{
+			double center = (d + 0.5) * scale - 0.5;
+			int s0 = int(floor(center));
+			float frac = float(center - s0);
+			t.push_back(Tap{ max(s0, 0), 1 - frac });
+			t.push_back(Tap{ min(s0 + 1, srcSize - 1), frac });
+		}
+	}
+	return taps;
+}
+
+TextureAtlas::TextureAtlas()
+ : m_height(0), m_numImages(0)
+{
+}
+
+vector<unsigned char> TextureAtlas::makeCell(const unsigned char* pixels, int width, int height, int bytesPerPixel)
+{
+	if (width <= 0  ||  height <= 0  ||  (bytesPerPixel != 3  &&  bytesPerPixel != 4))
+		return vector<unsigned char>();
+
+	const int content = CELL_SIZE - 2 * GUTTER;
+	vector<vector<Tap>> xTaps = makeTaps(width, content);
+	vector<vector<Tap>> yTaps = makeTaps(height, content);
+
+	  // Scale each row horizontally, then each resulting column vertically
+	vector<float> rows(size_t(height) * content * CHANNELS, 0);
+	for (int y = 0; y < height; y++)
+	{
+		const unsigned char* src = pixels + size_t(y) * width * bytesPerPixel;
+		float* dst = &rows[size_t(y) * content * CHANNELS];
+		for (int x = 0; x < content; x++)
+		{
+			for (const Tap& t : xTaps[x])
+			{
+				const unsigned char* p = src + size_t(t.source) * bytesPerPixel;
+				for (int c = 0; c < CHANNELS; c++)
+					dst[x * CHANNELS + c] += t.weight * (c < bytesPerPixel ? p[c] : 255);
+			}
+		}
+	}
+
+	vector<unsigned char> scaled(size_t(content) * content * CHANNELS);
+	for (int y = 0; y < content; y++)
+	{
+		for (int x = 0; x < content; x++)
+		{
+			float sum[CHANNELS] = { 0, 0, 0, 0 };
+			for (const Tap& t : yTaps[y])
+			{
+				const float* p = &rows[(size_t(t.source) * content + x) * CHANNELS];
+				for (int c = 0; c < CHANNELS; c++)
+					sum[c] += t.weight * p[c];
+			}
+			for (int c = 0; c < CHANNELS; c++)
+				scaled[(size_t(y) * content + x) * CHANNELS + c] =
+					static_cast<unsigned char>(min(max(sum[c] + 0.5f, 0.0f), 255.0f));
+		}
+	}
+
+	  // Fill the cell, repeating the edge pixels out into the gutter
+	vector<unsigned char> cellPixels(size_t(CELL_SIZE) * CELL_SIZE * CHANNELS);
+	for (int y = 0; y < CELL_SIZE; y++)
+	{
+		int sy = min(max(y - GUTTER, 0), content - 1);
+		for (int x = 0; x < CELL_SIZE; x++)
+		{
+			int sx = min(max(x - GUTTER, 0), content - 1);
+			const unsigned char* p = &scaled[(size_t(sy) * content + sx) * CHANNELS];
+			copy(p, p + CHANNELS, &cellPixels[(size_t(y) * CELL_SIZE + x) * CHANNELS]);
+		}
+	}
+	return cellPixels;
+}
+
+int TextureAtlas::addCell(const vector<unsigned char>& cellPixels)
+{
+	int cell = m_numImages;
+	int cellY = (cell / COLUMNS) * CELL_SIZE;
+	if (cellY + CELL_SIZE > m_height)
+	{
+		int newHeight = CELL_SIZE;
+		while (newHeight < cellY + CELL_SIZE)
+			newHeight *= 2;
+		m_pixels.resize(size_t(ATLAS_WIDTH) * newHeight * CHANNELS, 0);
+		m_height = newHeight;
+	}
+
+	copyCellLevel(cell, 0, cellPixels.data(), m_pixels.data());
+	m_numImages++;
+	return cell;
+}
+
+void TextureAtlas::copyCellLevel(int cell, int level, const unsigned char* cellPixels, unsigned char* atlasLevel)
+{
+	int size = CELL_SIZE >> level;
+	int atlasWidth = ATLAS_WIDTH >> level;
+	int cellX = (cell % COLUMNS) * size;
+	int cellY = (cell / COLUMNS) * size;
+	for (int y = 0; y < size; y++)
+		copy(cellPixels + size_t(y) * size * CHANNELS, cellPixels + size_t(y + 1) * size * CHANNELS,
+			 atlasLevel + (size_t(cellY + y) * atlasWidth + cellX) * CHANNELS);
+}
+
+vector<unsigned char> TextureAtlas::makeNextMipLevel(const unsigned char* pixels, int width, int height)
+{
+	int newWidth = max(width / 2, 1);
+	int newHeight = max(height / 2, 1);
+	int stepX = (width > 1 ? 1 : 0);
+	int stepY = (height > 1 ? 1 : 0);
+
+	vector<unsigned char> level(size_t(newWidth) * newHeight * CHANNELS);
+	for (int y = 0; y < newHeight; y++)
+	{
+		const unsigned char* row0 = pixels + size_t(2 * y) * width * CHANNELS;
+		const unsigned char* row1 = row0 + size_t(stepY) * width * CHANNELS;
+		unsigned char* dst = &level[size_t(y) * newWidth * CHANNELS];
+		for (int x = 0; x < newWidth; x++)
+		{
+			size_t left = size_t(2 * x) * CHANNELS;
+			size_t right = left + stepX * CHANNELS;
+			for (int c = 0; c < CHANNELS; c++)
+				dst[x * CHANNELS + c] = static_cast<unsigned char>(
+					(row0[left + c] + row0[right + c] + row1[left + c] + row1[right + c] + 2) / 4);
+		}
+	}
+	return level;
+}
+
+AtlasRect TextureAtlas::getRect(int cell) const
+{
+	  // Pull in half a texel so filtering at the edges stays inside the image
+	float x0 = float((cell % COLUMNS) * CELL_SIZE + GUTTER) + 0.5f;
+	float y0 = float((cell / COLUMNS) * CELL_SIZE + GUTTER) + 0.5f;
+	float size = float(CELL_SIZE - 2 * GUTTER) - 1;
+
+	AtlasRect r;
+	r.u0 = x0 / ATLAS_WIDTH;
+	r.v0 = y0 / m_height;
+	r.u1 = (x0 + size) / ATLAS_WIDTH;
+	r.v1 = (y0 + size) / m_height;
+	return r;
+}
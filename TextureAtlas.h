@@ -0,0 +1,101 @@
+#ifndef TEXTUREATLAS_H_
+#define TEXTUREATLAS_H_
+
+#include <vector>
+#include <utility>
+
+  // Packs many images into one BGRA image, so a whole scene can be drawn
+  // from a single texture.  Every image is resampled to fill one
+  // CELL_SIZE x CELL_SIZE cell (sprites are stretched to their quads
+  // anyway, so nothing is lost but resolution on huge images), inset by a
+  // GUTTER of repeated edge pixels so that filtering, including at the
+  // smaller mipmap levels, never picks up a neighboring cell.  Rows are
+  // kept in the order they were given, just as a texture made from the
+  // image alone would have them.
+  //
+  // The atlas is ATLAS_WIDTH wide and as tall as it needs to be, rounded up
+  // to a power of two.
+
+struct AtlasRect
+{
+	float	u0, v0;		// texture coordinates of the image's first pixel
+	float	u1, v1;		// and of its last
+};
+
+class TextureAtlas
+{
+  public:
+	static const int CELL_SIZE = 256;
+	static const int GUTTER = 4;
+	static const int ATLAS_WIDTH = 2048;
+
+	TextureAtlas();
+
+	  // Resamples an image of BGR (bytesPerPixel 3) or BGRA (4) pixels into
+	  // the CELL_SIZE x CELL_SIZE BGRA pixels of a cell, gutter included.
+	  // Returns an empty vector if the image is unusable.  Touches no
+	  // atlas, so images can be made into cells on several threads at once.
+	static std::vector<unsigned char> makeCell(const unsigned char* pixels, int width, int height, int bytesPerPixel);
+
+	  // Adds the pixels of a cell made by makeCell() and returns its cell
+	  // number
+	int addCell(const std::vector<unsigned char>& cellPixels);
+
+	  // Copies mipmap level `level` of a cell (CELL_SIZE >> level pixels
+	  // square) to where it belongs in the same level of the atlas, which
+	  // is getWidth() >> level pixels wide
+	static void copyCellLevel(int cell, int level, const unsigned char* cellPixels, unsigned char* atlasLevel);
+
+	  // Where an added image ended up.  Only final once every image has
+	  // been added, since adding one can make the atlas taller.
+	AtlasRect getRect(int cell) const;
+
+	int getWidth() const
+	{
+		return ATLAS_WIDTH;
+	}
+
+	int getHeight() const
+	{
+		return m_height;
+	}
+
+	int getNumImages() const
+	{
+		return m_numImages;
+	}
+
+	  // Hands over the getWidth() * getHeight() BGRA pixels; rects stay valid
+	std::vector<unsigned char> takePixels()
+	{
+		return std::move(m_pixels);
+	}
+
+	  // Frees the pixels (e.g., once they're in a texture); rects stay valid
+	void discardPixels()
+	{
+		std::vector<unsigned char>().swap(m_pixels);
+	}
+
+	  // Describes an atlas whose pixels are kept elsewhere (e.g., in an
+	  // AssetBundle), so that getRect() works
+	void restore(int height, int numImages)
+	{
+		discardPixels();
+		m_height = height;
+		m_numImages = numImages;
+	}
+
+	  // The next smaller mipmap level of a BGRA image: each pixel is the
+	  // average of the 2x2 block (or 2x1, once a side is down to 1) above it
+	static std::vector<unsigned char> makeNextMipLevel(const unsigned char* pixels, int width, int height);
+
+  private:
+	static const int COLUMNS = ATLAS_WIDTH / CELL_SIZE;
+
+	int		m_height;
+	int		m_numImages;
+	std::vector<unsigned char> m_pixels;
+};
+
+#endif // TEXTUREATLAS_H_
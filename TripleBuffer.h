@@ -0,0 +1,62 @@
+#ifndef TRIPLEBUFFER_H_
+#define TRIPLEBUFFER_H_
+
+#include <atomic>
+
+  // Hands the latest version of a T from one writer thread to one reader
+  // thread without either ever waiting on the other.  The writer fills in
+  // writeBuffer() and publish()es it; the reader calls update() to pick up
+  // the most recently published one, then uses readBuffer().  If the
+  // writer publishes several times between updates, the reader simply
+  // skips to the newest.  Each side keeps its buffer to itself until it
+  // trades it away, so buffers (and whatever memory they hold, e.g.,
+  // vectors) are reused rather than reallocated.
+
+template<typename T>
+class TripleBuffer
+{
+  public:
+	TripleBuffer()
+	 : m_write(0), m_ready(1), m_read(2)
+	{
+	}
+
+	T& writeBuffer()
+	{
+		return m_buffers[m_write];
+	}
+
+	void publish()
+	{
+		m_write = m_ready.exchange(m_write | FRESH, std::memory_order_acq_rel) & INDEX;
+	}
+
+	  // Returns true if something was published since the last update()
+	bool update()
+	{
+		if ((m_ready.load(std::memory_order_relaxed) & FRESH) == 0)
+			return false;
+		m_read = m_ready.exchange(m_read, std::memory_order_acq_rel) & INDEX;
+		return true;
+	}
+
+	const T& readBuffer() const
+	{
+		return m_buffers[m_read];
+	}
+
+  private:
+	static const int INDEX = 3;
+	static const int FRESH = 4;
+
+	T				m_buffers[3];
+	int				m_write;	// only touched by the writer
+	std::atomic<int> m_ready;	// index of the buffer in between, plus FRESH
+	int				m_read;		// only touched by the reader
+
+	  // Prevent copying or assigning TripleBuffers
+	TripleBuffer(const TripleBuffer&);
+	TripleBuffer& operator=(const TripleBuffer&);
+};
+
+#endif // TRIPLEBUFFER_H_
@@ -0,0 +1,75 @@
+#include "WAVFile.h"
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstring>
+#include <cstdint>
+using namespace std;
+
+static const int FORMAT_PCM = 1;
+static const int FORMAT_EXTENSIBLE = 0xFFFE;
+
+static uint32_t readLE(const unsigned char* p, int bytes)
+{
+	uint32_t value = 0;
+	for (int k = bytes - 1; k >= 0; k--)
+		value = value * 256 + p[k];
+	return value;
+}
+
+bool loadWAV(string filename, WAVSound& sound)
+{
+	ifstream wavFile(filename, ios::in|ios::binary);
+	if (!wavFile)
+		return false;
+	vector<unsigned char> contents((istreambuf_iterator<char>(wavFile)), istreambuf_iterator<char>());
+	if (contents.size() < 12  ||  memcmp(&contents[0], "RIFF", 4) != 0  ||  memcmp(&contents[8], "WAVE", 4) != 0)
+		return false;
+
+	  // Walk the chunks for the format and the samples; skip everything else
+	int format = 0;
+	int bitsPerSample = 0;
+	const unsigned char* data = nullptr;
+	size_t dataSize = 0;
+	size_t position = 12;
+	while (position + 8 <= contents.size())
+	{
+		const unsigned char* chunk = &contents[position];
+		size_t chunkSize = readLE(chunk + 4, 4);
+		size_t available = contents.size() - position - 8;
+		if (chunkSize > available)
+			chunkSize = available;	// some writers leave the size of the last chunk wrong
+
+		if (memcmp(chunk, "fmt ", 4) == 0  &&  chunkSize >= 16)
+		{
+			format = readLE(chunk + 8, 2);
+			sound.channels = readLE(chunk + 10, 2);
+			sound.sampleRate = readLE(chunk + 12, 4);
+			bitsPerSample = readLE(chunk + 22, 2);
+		}
+		else if (memcmp(chunk, "data", 4) == 0)
+		{
+			data = chunk + 8;
+			dataSize = chunkSize;
+		}
+		position += 8 + chunkSize + (chunkSize & 1);
+	}
+
+	if ((format != FORMAT_PCM  &&  format != FORMAT_EXTENSIBLE)  ||  data == nullptr  ||
+		(sound.channels != 1  &&  sound.channels != 2)  ||  sound.sampleRate <= 0  ||
+		(bitsPerSample != 8  &&  bitsPerSample != 16))
+		return false;
+
+	  // 8 bit samples are unsigned, 16 bit ones signed
+	size_t bytesPerSample = bitsPerSample / 8;
+	size_t numSamples = dataSize / bytesPerSample / sound.channels * sound.channels;
+	sound.samples.resize(numSamples);
+	for (size_t k = 0; k < numSamples; k++)
+	{
+		if (bytesPerSample == 1)
+			sound.samples[k] = static_cast<short>((data[k] - 128) * 256);
+		else
+			sound.samples[k] = static_cast<short>(readLE(data + 2 * k, 2));
+	}
+	return true;
+}
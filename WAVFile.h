@@ -0,0 +1,21 @@
+#ifndef WAVFILE_H_
+#define WAVFILE_H_
+
+#include <string>
+#include <vector>
+
+  // The samples of an uncompressed (PCM) WAV file, converted to signed
+  // 16 bit and interleaved if there is more than one channel.
+
+struct WAVSound
+{
+	int		sampleRate = 0;
+	int		channels = 0;
+	std::vector<short> samples;
+};
+
+  // Returns false if the file can't be read or isn't 8 or 16 bit PCM with
+  // one or two channels
+bool loadWAV(std::string filename, WAVSound& sound);
+
+#endif // WAVFILE_H_
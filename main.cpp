@@ -4,6 +4,7 @@
 #include <string>
 #include <cstdlib>
 #include <ctime>
+#include <cmath>
 using namespace std;
 
 #ifdef _MSC_VER
@@ -32,8 +33,72 @@ class GameWorld;
 
 GameWorld* createStudentWorld(string assetPath = "");
 
+  // A finite number above 0, with nothing after it
+static bool parsePositive(const char* text, double& value)
+{
+    char* end;
+    value = strtod(text, &end);
+    return *text != '\0'  &&  *end == '\0'  &&  value > 0  &&  isfinite(value);
+}
+
+static void usage(const char* program)
+{
+    cout << "usage: " << program << " [--record file] [--tick-rate N] [--fps N]"
+         << " [--profile-csv file] [--trace file]" << endl;
+}
+
 int main(int argc, char* argv[])
 {
+      // --record file saves the session as a replay that
+      // GhostRacerHeadless --replay file can play back; --tick-rate N and
+      // --fps N tick the world and draw N times a second; --profile-csv
+      // file writes how long each tick's phases took, and --trace file
+      // writes a Chrome trace of the session (if built with GR_PROFILE).
+      // Every option takes a value.
+    string recordPath;
+    for (int k = 1; k < argc; k++)
+    {
+        string option = argv[k];
+        if ((option != "--record"  &&  option != "--tick-rate"  &&  option != "--fps"  &&
+             option != "--profile-csv"  &&  option != "--trace")  ||  k+1 == argc)
+        {
+            usage(argv[0]);
+            return 1;
+        }
+        if (option == "--record")
+            recordPath = argv[++k];
+        else if (option == "--tick-rate"  ||  option == "--fps")
+        {
+            double rate;
+            if (!parsePositive(argv[++k], rate))
+            {
+                cout << option << " must be followed by a positive number" << endl;
+                usage(argv[0]);
+                return 1;
+            }
+            if (option == "--tick-rate")
+                Game().setTickRate(rate);
+            else
+                Game().setFrameRate(rate);
+        }
+        else if (option == "--profile-csv"  ||  option == "--trace")
+        {
+#ifdef GR_PROFILE
+            string path = argv[++k];
+            if (option == "--profile-csv")
+                Game().profileTo(path);
+            else if (!Trace().start(path))
+            {
+                cout << "Cannot write trace file " << path << endl;
+                return 1;
+            }
+#else
+            cout << option << " needs a build with GR_PROFILE defined (e.g., the Profile configuration)" << endl;
+            return 1;
+#endif
+        }
+    }
+
     string assetPath = assetDirectory;
     if (!assetPath.empty())
     {
@@ -58,5 +123,7 @@ int main(int argc, char* argv[])
 	srand(static_cast<unsigned int>(time(nullptr)));
 
 	GameWorld* gw = createStudentWorld(assetPath);
+	if (!recordPath.empty())
+		Game().recordTo(recordPath);
 	Game().run(argc, argv, gw, "Ghost Racer");
 }